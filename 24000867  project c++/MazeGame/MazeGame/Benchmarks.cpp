@@ -0,0 +1,425 @@
+#include "Benchmarks.h"
+#include "Visibility.h"
+#include "Player.h"  // Benchmarks move viewers with the game's own rules.
+#include "Enemy.h"
+#include "EnemyScheduler.h"
+#include "Solver.h"
+#include "HighScores.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>    // For fixed-seed mazes and walks.
+#include <chrono>    // For timing.
+#include <cmath>     // For std::sqrt.
+#include <algorithm> // For std::shuffle.
+#include <thread>    // For std::thread::hardware_concurrency and sleep_until.
+#include <fstream>   // For checking whether a stress file already exists.
+#include <cstdio>    // For std::remove (stress file).
+
+// --- Platform Specific Includes (starting processes for the high score stress test) ---
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/wait.h> // For waitpid()
+#include <unistd.h>   // For fork() and _exit()
+#endif
+// --- End Platform Specific Includes ---
+
+// A square random maze: every cell is a wall with probability 1 / 'wallOneIn',
+// and the centre cell is always open. The same seed always gives the same maze.
+static std::vector<std::string> randomMaze(int side, int wallOneIn, std::mt19937& rng) {
+    std::uniform_int_distribution<int> wall(0, wallOneIn - 1);
+    std::vector<std::string> maze(side, std::string(side, ' '));
+    for (auto& row : maze) {
+        for (char& cell : row) {
+            if (wall(rng) == 0) {
+                cell = '#';
+            }
+        }
+    }
+    maze[side / 2][side / 2] = ' ';
+    return maze;
+}
+
+
+// --- Field of View ---
+
+void benchmarkFov() {
+    const int SIDE = 512;           // Maze size (cells per side).
+    const int WALL_ONE_IN = 4;      // One wall in four cells.
+    const int MOVES = 200000;       // Steps of the viewer's random walk.
+    const int QUERY_OFFSETS = 4096; // Precomputed query positions (so the RNG is not timed).
+    const int QUERIES_PER_MOVE = 1024; // Large batches, so the clock reads cost little.
+
+    std::mt19937 rng(2026);
+    std::vector<std::string> maze = randomMaze(SIDE, WALL_ONE_IN, rng);
+
+    Visibility view;
+    auto buildStart = std::chrono::steady_clock::now();
+    view.build(maze);
+    double buildSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - buildStart).count();
+
+    // Query positions within 10 cells of the viewer: inside, on the edge of and just
+    // outside the radius-8 view, like enemies asking "can the player see me?".
+    std::uniform_int_distribution<int> offset(-10, 10);
+    std::vector<Position> offsets;
+    for (int i = 0; i < QUERY_OFFSETS; ++i) {
+        offsets.push_back(Position(offset(rng), offset(rng)));
+    }
+
+    const char moves[4] = { 'W', 'A', 'S', 'D' };
+    std::uniform_int_distribution<int> direction(0, 3);
+    Player viewer(SIDE / 2, SIDE / 2);
+    long long updates = 0;
+    long long queries = 0;
+    long long visibleHits = 0; // Printed, so the compiler cannot drop the queries.
+    double updateSeconds = 0.0;
+    double querySeconds = 0.0;
+    int next = 0;
+
+    for (int m = 0; m < MOVES; ++m) {
+        if (!viewer.move(moves[direction(rng)], maze)) {
+            continue; // Bumped into a wall: nothing to recompute.
+        }
+        Position p = viewer.getPosition();
+
+        auto start = std::chrono::steady_clock::now();
+        view.update(p);
+        auto middle = std::chrono::steady_clock::now();
+        for (int q = 0; q < QUERIES_PER_MOVE; ++q) {
+            const Position& o = offsets[next];
+            next = (next + 1) & (QUERY_OFFSETS - 1);
+            visibleHits += view.isVisible(p.x + o.x, p.y + o.y);
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        updateSeconds += std::chrono::duration<double>(middle - start).count();
+        querySeconds += std::chrono::duration<double>(end - middle).count();
+        updates++;
+        queries += QUERIES_PER_MOVE;
+    }
+
+    std::cout << "--- Field of View Benchmark (" << SIDE << "x" << SIDE << " maze, 1 wall in "
+        << WALL_ONE_IN << ", radius 8) ---\n";
+    std::cout << "Build: " << buildSeconds * 1e3 << " ms\n";
+    std::cout << "Updates: " << updates << " in " << updateSeconds << " s = "
+        << (updateSeconds > 0.0 ? updates / updateSeconds : 0.0) << " updates/s\n";
+    std::cout << "Queries: " << queries << " in " << querySeconds << " s = "
+        << (querySeconds > 0.0 ? queries / querySeconds : 0.0) << " queries/s ("
+        << visibleHits << " visible)\n";
+}
+
+
+// --- Enemy Scheduling ---
+
+// Measures EnemyScheduler::tick() for 1k, 10k and 100k enemies.
+// The field grows with the enemy count (same density), so about the same number of
+// enemies are near the player each time: the cost per tick should follow the number of
+// active enemies, not the total.
+void benchmarkEnemies() {
+    const int ENEMY_COUNTS[] = { 1000, 10000, 100000 };
+    const int CELLS_PER_ENEMY = 40; // Field density: one enemy per 40 cells.
+    const int TICKS = 20000;
+
+    std::mt19937 rng(2024); // Fixed seed: the same field and walk every run.
+    std::cout << "--- Enemy Scheduler Benchmark (" << TICKS << " ticks each) ---\n";
+    for (int count : ENEMY_COUNTS) {
+        int side = int(std::sqrt(double(count) * CELLS_PER_ENEMY));
+        std::uniform_int_distribution<int> cell(0, side - 1);
+
+        // An open field with one wall in eight cells, so sight and movement are not trivial.
+        std::vector<std::string> field(side, std::string(side, ' '));
+        for (int walls = side * side / 8; walls > 0; --walls) {
+            field[cell(rng)][cell(rng)] = '#';
+        }
+        Player walker(side / 2, side / 2);
+        field[side / 2][side / 2] = ' ';
+
+        std::vector<Enemy> crowd;
+        crowd.reserve(count);
+        while (int(crowd.size()) < count) {
+            int x = cell(rng);
+            int y = cell(rng);
+            if (field[y][x] == ' ' && walker.getPosition() != Position(x, y)) {
+                crowd.push_back(Enemy(x, y));
+            }
+        }
+
+        Visibility view;
+        view.build(field);
+        view.update(walker.getPosition());
+        EnemyScheduler scheduler;
+        scheduler.start(crowd, field, view);
+
+        // The player wanders at random; only the scheduler's work is timed.
+        const char moves[4] = { 'W', 'A', 'S', 'D' };
+        std::uniform_int_distribution<int> direction(0, 3);
+        long long active = 0;
+        double seconds = 0.0;
+        for (int t = 0; t < TICKS; ++t) {
+            if (walker.move(moves[direction(rng)], field)) {
+                view.update(walker.getPosition());
+            }
+            auto start = std::chrono::steady_clock::now();
+            active += scheduler.tick(walker.getPosition());
+            seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        double activePerTick = double(active) / TICKS;
+        std::cout << count << " enemies (" << side << "x" << side << "): "
+            << activePerTick << " active per tick, " << seconds / TICKS * 1e6 << " us per tick, "
+            << (active > 0 ? seconds / active * 1e9 : 0.0) << " ns per active enemy\n";
+        scheduler.clear(); // Behaviors refer to 'crowd'; destroy them first.
+    }
+}
+
+
+// --- Solver ---
+
+// A maze with corridors one cell wide ('side' must be odd): a randomised depth-first
+// search carves a perfect maze (exactly one path between any two cells), then
+// 'extraOpenings' random walls are knocked out so there are loops and several routes.
+static std::vector<std::string> carvedMaze(int side, int extraOpenings, std::mt19937& rng) {
+    std::vector<std::string> maze(side, std::string(side, '#'));
+    const int dx[4] = { 0, 0, -2, 2 };
+    const int dy[4] = { -2, 2, 0, 0 };
+
+    std::vector<Position> stack = { Position(1, 1) };
+    maze[1][1] = ' ';
+    while (!stack.empty()) {
+        Position current = stack.back();
+        int order[4] = { 0, 1, 2, 3 };
+        std::shuffle(order, order + 4, rng);
+        bool carved = false;
+        for (int d : order) {
+            int nx = current.x + dx[d];
+            int ny = current.y + dy[d];
+            if (nx > 0 && nx < side - 1 && ny > 0 && ny < side - 1 && maze[ny][nx] == '#') {
+                maze[current.y + dy[d] / 2][current.x + dx[d] / 2] = ' ';
+                maze[ny][nx] = ' ';
+                stack.push_back(Position(nx, ny));
+                carved = true;
+                break;
+            }
+        }
+        if (!carved) {
+            stack.pop_back();
+        }
+    }
+
+    std::uniform_int_distribution<int> inner(1, side - 2);
+    for (int i = 0; i < extraOpenings; ++i) {
+        maze[inner(rng)][inner(rng)] = ' ';
+    }
+    return maze;
+}
+
+void benchmarkSolver() {
+    struct Case {
+        int side;          // Maze size (odd).
+        int collectibles;  // Number of '*' placed.
+    };
+    // The first case is small enough for the exact search; the others use the heuristic.
+    const Case cases[] = { { 201, Solver::MAX_EXACT_COLLECTIBLES }, { 501, 100 }, { 1001, 300 } };
+
+    std::mt19937 rng(2030);
+    std::cout << "--- Solver Benchmark (fixed-seed carved mazes, "
+        << std::thread::hardware_concurrency() << " hardware threads) ---\n";
+    for (const Case& c : cases) {
+        std::vector<std::string> maze = carvedMaze(c.side, c.side * c.side / 50, rng);
+        Position start(1, 1);
+        Position exit(c.side - 2, c.side - 2);
+
+        // Collectibles on distinct open cells other than the start and the exit.
+        std::uniform_int_distribution<int> inner(1, c.side - 2);
+        int placed = 0;
+        while (placed < c.collectibles) {
+            Position p(inner(rng), inner(rng));
+            if (maze[p.y][p.x] == ' ' && p != start && p != exit) {
+                maze[p.y][p.x] = '*';
+                placed++;
+            }
+        }
+
+        auto begin = std::chrono::steady_clock::now();
+        Solution solution = Solver::solve(maze, start, exit);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        bool valid = solution.solved && Solver::verify(maze, start, exit, solution.path);
+
+        std::cout << c.side << "x" << c.side << ", " << c.collectibles << " collectibles: ";
+        if (!solution.solved) {
+            std::cout << "not solved\n";
+            continue;
+        }
+        std::cout << solution.moves << " moves" << (solution.optimal ? " (optimal)" : " (heuristic)")
+            << " in " << seconds << " s, replay " << (valid ? "verified" : "FAILED") << "\n";
+    }
+}
+
+
+// --- High Score Stress Test ---
+
+// A separate file keeps the real leaderboards clean.
+const std::string STRESS_FILE = "highscores-stress.dat";
+const int STRESS_RANDOM_LEVEL = 1;     // Round 1: random results, almost all rejected by a read-only scan.
+const int STRESS_RISING_LEVEL = 2;     // Round 2: rising scores, nearly every submission must be written.
+const int STRESS_SUBMISSIONS = 200000; // Submissions per process.
+
+// One stress test result. Each process draws from its own fixed seed, so the parent can
+// replay every submission afterwards and work out the true top TOP_K.
+// On the rising level the score is the submission number, so every process keeps
+// beating the current table at the same time: the worst case for contention.
+static HighScore stressResult(std::mt19937& rng, int level, int submission) {
+    std::uniform_int_distribution<int> score(0, 999999);
+    std::uniform_int_distribution<int> moves(1, 9999);
+    HighScore result;
+    result.score = (level == STRESS_RISING_LEVEL) ? submission : score(rng);
+    result.moves = moves(rng);
+    return result;
+}
+
+// Seed of one process's results (different for every process and level).
+static unsigned stressSeed(int worker, int level) {
+    return unsigned(worker + 1) * 1000u + unsigned(level);
+}
+
+// Starts 'processes' processes that all submit to 'level' at the same moment, waits for
+// them, then checks the final table against a replay of every submission.
+static void runStressRound(int processes, int level) {
+    // Every process sleeps until this moment, so they really submit at the same time.
+    auto startAt = std::chrono::system_clock::now() + std::chrono::milliseconds(500 + 20 * processes);
+    long long startAtMs = std::chrono::duration_cast<std::chrono::milliseconds>(startAt.time_since_epoch()).count();
+
+    int started = 0;
+    int failed = 0;
+#ifdef _WIN32
+    // Windows has no fork(): run this program again in worker mode.
+    char self[MAX_PATH];
+    GetModuleFileNameA(nullptr, self, MAX_PATH);
+    std::vector<HANDLE> children;
+    for (int worker = 0; worker < processes; ++worker) {
+        std::string command = "\"" + std::string(self) + "\" --scores-worker " + std::to_string(worker)
+            + "," + std::to_string(level) + "," + std::to_string(startAtMs);
+        std::vector<char> commandLine(command.begin(), command.end());
+        commandLine.push_back('\0');
+        STARTUPINFOA startup = {};
+        startup.cb = sizeof(startup);
+        PROCESS_INFORMATION info;
+        if (!CreateProcessA(self, commandLine.data(), nullptr, nullptr, FALSE, 0, nullptr, nullptr, &startup, &info)) {
+            std::cerr << "Error: Could not start stress process " << worker << std::endl;
+            break;
+        }
+        CloseHandle(info.hThread);
+        children.push_back(info.hProcess);
+    }
+    for (HANDLE child : children) {
+        WaitForSingleObject(child, INFINITE);
+        DWORD code = 1;
+        if (!GetExitCodeProcess(child, &code) || code != 0) {
+            failed++;
+        }
+        CloseHandle(child);
+    }
+    started = children.size();
+#else
+    std::cout.flush(); // Children must not inherit (and print again) buffered output.
+    std::vector<pid_t> children;
+    for (int worker = 0; worker < processes; ++worker) {
+        pid_t child = fork();
+        if (child == 0) {
+            _exit(runHighScoreWorker(worker, level, startAtMs) ? 0 : 1);
+        }
+        if (child < 0) {
+            std::cerr << "Error: Could not start stress process " << worker << std::endl;
+            break;
+        }
+        children.push_back(child);
+    }
+    for (pid_t child : children) {
+        int status = 0;
+        if (waitpid(child, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            failed++;
+        }
+    }
+    started = children.size();
+#endif
+    double seconds = std::chrono::duration<double>(std::chrono::system_clock::now() - startAt).count();
+
+    HighScoreStore store;
+    if (!store.open(STRESS_FILE)) {
+        return;
+    }
+    HighScoreStore::Stats stats = store.getStats(level);
+    std::cout << (level == STRESS_RISING_LEVEL ? "Rising scores" : "Random scores") << ": "
+        << started << " processes (" << failed << " failed), " << stats.submissions << " submissions in "
+        << seconds << " s = " << (seconds > 0.0 ? stats.submissions / seconds : 0.0) << " submissions/s\n";
+    std::cout << "  Written to the table: " << stats.updates << ", CAS retries: " << stats.casRetries << " ("
+        << (stats.updates > 0 ? double(stats.casRetries) / stats.updates : 0.0) << " per write)\n";
+    if (started == 0 || failed > 0) {
+        std::cout << "  Final table not checked: not every process completed.\n";
+        return;
+    }
+
+    // Replay every submission and keep the true best TOP_K (higher score, then fewer moves).
+    auto better = [](const HighScore& a, const HighScore& b) {
+        return a.score != b.score ? a.score > b.score : a.moves < b.moves;
+    };
+    std::vector<HighScore> best;
+    for (int worker = 0; worker < started; ++worker) {
+        std::mt19937 rng(stressSeed(worker, level));
+        for (int i = 0; i < STRESS_SUBMISSIONS; ++i) {
+            best.push_back(stressResult(rng, level, i));
+        }
+        size_t keep = std::min<size_t>(best.size(), HighScoreStore::TOP_K);
+        std::partial_sort(best.begin(), best.begin() + keep, best.end(), better);
+        best.resize(keep);
+    }
+    std::vector<HighScore> table = store.top(level);
+    bool matches = table.size() == best.size();
+    for (size_t i = 0; matches && i < table.size(); ++i) {
+        matches = table[i].score == best[i].score && table[i].moves == best[i].moves;
+    }
+    std::cout << "  Final table is the true top " << HighScoreStore::TOP_K << ": " << (matches ? "yes" : "NO") << "\n";
+}
+
+// Runs both rounds of the stress test and prints the results of each.
+void stressHighScores(int processes) {
+    if (processes < 1) {
+        std::cerr << "Error: The stress test needs at least one process." << std::endl;
+        return;
+    }
+
+    // Start from an empty table, but only ever delete a previous stress file.
+    std::ifstream existing(STRESS_FILE);
+    if (existing.is_open()) {
+        existing.close();
+        HighScoreStore previous;
+        if (!previous.open(STRESS_FILE)) {
+            return; // Not ours: open() has said why, and the file is left alone.
+        }
+    }
+    std::remove(STRESS_FILE.c_str());
+
+    std::cout << "--- High Score Stress Test: " << processes << " processes x " << STRESS_SUBMISSIONS
+        << " submissions, " << std::thread::hardware_concurrency() << " hardware threads ---\n";
+    const int levels[2] = { STRESS_RANDOM_LEVEL, STRESS_RISING_LEVEL };
+    for (int level : levels) {
+        runStressRound(processes, level);
+    }
+}
+
+// One stress test process: waits for the common start time, then submits as fast as it can.
+bool runHighScoreWorker(int worker, int level, long long startAtMs) {
+    HighScoreStore store;
+    if (!store.open(STRESS_FILE)) {
+        return false;
+    }
+    std::mt19937 rng(stressSeed(worker, level));
+    std::this_thread::sleep_until(std::chrono::system_clock::time_point(std::chrono::milliseconds(startAtMs)));
+    for (int i = 0; i < STRESS_SUBMISSIONS; ++i) {
+        HighScore result = stressResult(rng, level, i);
+        store.submit(level, result.score, result.moves);
+    }
+    return true;
+}
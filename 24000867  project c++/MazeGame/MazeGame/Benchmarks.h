@@ -0,0 +1,28 @@
+#pragma once // Standard include guard.
+
+// Reproducible performance measurements, run from the command line (see main.cpp).
+// Each one builds its own fixed-seed data and touches no Game state, so they live
+// here instead of in the Game class.
+
+// Field of view: times Visibility::update() while a viewer walks around a large random
+// maze, and isVisible() queries around the viewer. Prints updates/s and queries/s.
+void benchmarkFov();
+
+// Enemy scheduling: times EnemyScheduler::tick() with 1k, 10k and 100k enemies and prints
+// the cost per tick next to the number of enemies that were active.
+void benchmarkEnemies();
+
+// Solver: solves large fixed-seed mazes with 16, 100 and 300 collectibles and prints
+// the solve time and route length, replaying every route with Solver::verify().
+void benchmarkSolver();
+
+// Stress test for the shared leaderboard: 'processes' processes submit to one level of
+// a separate file at the same moment, first random results, then rising scores.
+// Prints submissions per second, compare-and-swap retries (contention) and whether
+// each final table is the true top 10.
+void stressHighScores(int processes);
+
+// Body of one stress test process (started by stressHighScores()). 'startAtMs' is the
+// common start time in milliseconds since the system clock's epoch.
+// Returns false if the stress file could not be opened.
+bool runHighScoreWorker(int worker, int level, long long startAtMs);
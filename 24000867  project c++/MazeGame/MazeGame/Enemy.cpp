@@ -1,5 +1,7 @@
 #include "Enemy.h"
 #include <chrono> // Needed for seeding the random number generator using time.
+#include <cstdlib> // For std::abs.
+#include <utility> // For std::swap.
 
 // Constructor implementation.
 // Calls the base Entity constructor to set position and symbol ('X').
@@ -57,4 +59,67 @@ void Enemy::moveRandomly(const std::vector<std::string>& maze) {
         // this attempt is considered invalid for this simple AI. Try again.
     }
     // If loop finishes (MAX_MOVE_ATTEMPTS reached), the enemy didn't find a valid move this turn.
-}
\ No newline at end of file
+}
+
+// Chasing movement logic.
+void Enemy::moveToward(const Position& target, const std::vector<std::string>& maze) {
+    int dx = (target.x > pos.x) - (target.x < pos.x); // -1, 0 or +1 along each axis.
+    int dy = (target.y > pos.y) - (target.y < pos.y);
+
+    // Prefer closing the larger gap first so the enemy heads straight for the player.
+    Position steps[2] = { Position(pos.x + dx, pos.y), Position(pos.x, pos.y + dy) };
+    if (std::abs(target.y - pos.y) > std::abs(target.x - pos.x)) {
+        std::swap(steps[0], steps[1]);
+    }
+
+    for (const Position& next : steps) {
+        if (next == pos) {
+            continue; // No movement needed along this axis.
+        }
+        if (next.y < 0 || next.y >= maze.size() || next.x < 0 || next.x >= maze[next.y].size()) {
+            continue;
+        }
+        // Same rule as moveRandomly(): enemies only walk on empty path tiles.
+        if (maze[next.y][next.x] == ' ') {
+            setPosition(next);
+            return;
+        }
+    }
+
+    // Both direct steps blocked (e.g. a wall in between): wander instead of standing still.
+    moveRandomly(maze);
+}
+
+
+// Behavior tuning (in ticks / steps).
+// ACTIVATION_RADIUS is larger than the player's sight radius, so every enemy the player
+// can see is already awake.
+const int ACTIVATION_RADIUS = 12; // Enemies further away than this (Manhattan) sleep.
+const int PATROL_STEPS = 6;       // Random steps before taking a break.
+const int WAIT_TICKS = 2;         // Length of the break.
+
+// Enemy behavior coroutine.
+// Written as straight-line code: each co_await hands control back to the scheduler,
+// which resumes the enemy only when it has something to do.
+EnemyTask Enemy::behave(EnemyScheduler& scheduler) {
+    int patrolSteps = 0;
+    while (true) {
+        // Far from the player: cost nothing until the player could be close.
+        co_await scheduler.playerWithin(*this, ACTIVATION_RADIUS);
+
+        if (scheduler.canSeePlayer(*this)) {
+            moveToward(scheduler.getPlayerPosition(), scheduler.getMaze()); // Chase.
+            patrolSteps = 0;
+        }
+        else if (patrolSteps >= PATROL_STEPS) {
+            patrolSteps = 0;
+            co_await scheduler.sleep(WAIT_TICKS); // Wait.
+            continue;
+        }
+        else {
+            moveRandomly(scheduler.getMaze()); // Patrol.
+            patrolSteps++;
+        }
+        co_await scheduler.sleep(1); // Act again next tick.
+    }
+}
@@ -4,6 +4,7 @@
 #include <vector>   // Needed for maze data access during movement.
 #include <string>   // Needed for maze data type.
 #include <random>   // Include for C++ random number generation.
+#include "EnemyScheduler.h" // Behaviors are coroutines run by the scheduler (needs C++20).
 
 // Represents an enemy character, inheriting from Entity.
 // Why Inheritance: Enemy *is an* Entity, sharing position and symbol.
@@ -26,4 +27,15 @@ public:
     // Takes the maze layout (`const&`) to check for valid moves (walls/boundaries).
     // Not 'const' because it modifies the enemy's position.
     void moveRandomly(const std::vector<std::string>& maze);
+
+    // Moves one step towards 'target' (used once the enemy has noticed the player).
+    // Tries the axis with the larger distance first; falls back to a random move
+    // if both closer cells are blocked.
+    void moveToward(const Position& target, const std::vector<std::string>& maze);
+
+    // --- Behavior ---
+    // The enemy's behavior as a C++20 coroutine, resumed by the EnemyScheduler:
+    // sleeps while the player is far away, chases the player on sight, and otherwise
+    // patrols (wanders) for a few steps, then waits a few ticks.
+    EnemyTask behave(EnemyScheduler& scheduler);
 };
\ No newline at end of file
@@ -0,0 +1,208 @@
+#include "EnemyScheduler.h"
+#include "Enemy.h"
+#include "Visibility.h"
+#include <cstdlib>   // For std::abs.
+#include <algorithm> // For std::max, std::min.
+#include <exception> // For std::terminate.
+
+// --- EnemyTask ---
+
+// Behaviors are not expected to throw; an escaping exception is a bug.
+void EnemyTask::promise_type::unhandled_exception() {
+    std::terminate();
+}
+
+EnemyTask& EnemyTask::operator=(EnemyTask&& other) noexcept {
+    if (this != &other) {
+        if (handle) {
+            handle.destroy();
+        }
+        handle = other.handle;
+        other.handle = nullptr;
+    }
+    return *this;
+}
+
+EnemyTask::~EnemyTask() {
+    if (handle) {
+        handle.destroy();
+    }
+}
+
+// --- Awaitables ---
+
+bool EnemyScheduler::PlayerWithinAwaiter::await_ready() const {
+    return scheduler.distanceToPlayer(enemy) <= radius;
+}
+
+// Waits in the bucket of the enemy's block; tick() wakes it once the player is close.
+void EnemyScheduler::PlayerWithinAwaiter::await_suspend(std::coroutine_handle<>) {
+    scheduler.park(scheduler.current, radius);
+}
+
+// --- EnemyScheduler ---
+
+EnemyScheduler::EnemyScheduler()
+    : enemies(nullptr), maze(nullptr), fov(nullptr), player(-1, -1), current(-1), width(0), height(0),
+    bucketsWide(0), maxWaitRadius(0)
+{
+}
+
+EnemyScheduler::SleepAwaiter EnemyScheduler::sleep(int ticks) {
+    return SleepAwaiter{ *this, ticks };
+}
+
+EnemyScheduler::PlayerWithinAwaiter EnemyScheduler::playerWithin(const Enemy& enemy, int radius) {
+    return PlayerWithinAwaiter{ *this, enemy, radius };
+}
+
+void EnemyScheduler::schedule(int enemy, int delay) {
+    wheel.schedule(enemy, delay > 0 ? delay : 1);
+}
+
+// Waiting enemies do not move, so the block they are filed under stays correct.
+void EnemyScheduler::park(int enemy, int radius) {
+    Position p = (*enemies)[enemy].getPosition();
+    int bx = std::min(std::max(p.x, 0), width - 1) / BUCKET_SIZE;
+    int by = std::min(std::max(p.y, 0), height - 1) / BUCKET_SIZE;
+    int bucket = by * bucketsWide + bx;
+
+    waiting[enemy] = Waiting{ radius, bucket, int(buckets[bucket].size()) };
+    buckets[bucket].push_back(enemy);
+    maxWaitRadius = std::max(maxWaitRadius, radius);
+}
+
+// Swap-and-pop: the last enemy of the bucket takes over the freed slot.
+void EnemyScheduler::unpark(int enemy) {
+    std::vector<int>& bucket = buckets[waiting[enemy].bucket];
+    int slot = waiting[enemy].slot;
+    int moved = bucket.back();
+    bucket[slot] = moved;
+    waiting[moved].slot = slot;
+    bucket.pop_back();
+    waiting[enemy].radius = -1;
+}
+
+// Only the blocks that overlap the square of side 2 * maxWaitRadius around the player
+// can hold an enemy within its radius; nothing further away is looked at.
+void EnemyScheduler::wakeNearby(std::vector<int>& due) {
+    if (buckets.empty()) {
+        return;
+    }
+    int x0 = std::max(player.x - maxWaitRadius, 0) / BUCKET_SIZE;
+    int x1 = std::min(std::max(player.x + maxWaitRadius, 0), width - 1) / BUCKET_SIZE;
+    int y0 = std::max(player.y - maxWaitRadius, 0) / BUCKET_SIZE;
+    int y1 = std::min(std::max(player.y + maxWaitRadius, 0), height - 1) / BUCKET_SIZE;
+
+    for (int by = y0; by <= y1; ++by) {
+        for (int bx = x0; bx <= x1; ++bx) {
+            std::vector<int>& bucket = buckets[by * bucketsWide + bx];
+            for (size_t i = 0; i < bucket.size(); ) {
+                int enemy = bucket[i];
+                if (distanceToPlayer((*enemies)[enemy]) <= waiting[enemy].radius) {
+                    unpark(enemy); // Moves another enemy into slot i: check it next.
+                    due.push_back(enemy);
+                }
+                else {
+                    ++i;
+                }
+            }
+        }
+    }
+}
+
+int EnemyScheduler::occupancyIndex(const Position& p) const {
+    if (p.x < 0 || p.x >= width || p.y < 0 || width == 0 || p.y >= int(occupancy.size()) / width) {
+        return -1;
+    }
+    return p.y * width + p.x;
+}
+
+void EnemyScheduler::start(std::vector<Enemy>& enemyList, const std::vector<std::string>& mazeData, const Visibility& view) {
+    clear();
+    enemies = &enemyList;
+    maze = &mazeData;
+    fov = &view;
+
+    width = mazeData.empty() ? 0 : mazeData[0].size();
+    height = mazeData.size();
+    occupancy.assign(height * width, 0);
+
+    if (width > 0) {
+        bucketsWide = (width + BUCKET_SIZE - 1) / BUCKET_SIZE;
+        buckets.assign(bucketsWide * ((height + BUCKET_SIZE - 1) / BUCKET_SIZE), std::vector<int>());
+    }
+    waiting.assign(enemyList.size(), Waiting{ -1, 0, 0 });
+
+    tasks.reserve(enemyList.size());
+    for (int i = 0; i < int(enemyList.size()); ++i) {
+        tasks.push_back(enemyList[i].behave(*this));
+        schedule(i, 1); // Every behavior gets to run once on the first tick.
+
+        int cell = occupancyIndex(enemyList[i].getPosition());
+        if (cell >= 0) {
+            occupancy[cell]++;
+        }
+    }
+}
+
+void EnemyScheduler::clear() {
+    tasks.clear(); // Destroys the coroutine frames.
+    wheel.clear();
+    occupancy.clear();
+    buckets.clear();
+    waiting.clear();
+    maxWaitRadius = 0;
+    enemies = nullptr;
+    current = -1;
+}
+
+int EnemyScheduler::tick(const Position& playerPos) {
+    player = playerPos;
+    dueNow.clear();
+    wheel.advance(dueNow);  // Sleepers whose time is up.
+    wakeNearby(dueNow);     // Waiters the player has come close to.
+
+    int active = 0;
+    for (int index : dueNow) {
+        Enemy& enemy = (*enemies)[index];
+
+        std::coroutine_handle<> handle = tasks[index].getHandle();
+        if (!handle || handle.done()) {
+            continue;
+        }
+
+        int before = occupancyIndex(enemy.getPosition());
+        current = index;
+        handle.resume(); // Runs the behavior until its next co_await.
+        current = -1;
+        active++;
+
+        int after = occupancyIndex(enemy.getPosition());
+        if (before != after) {
+            if (before >= 0) {
+                occupancy[before]--;
+            }
+            if (after >= 0) {
+                occupancy[after]++;
+            }
+        }
+    }
+    return active;
+}
+
+bool EnemyScheduler::isOccupied(const Position& p) const {
+    int cell = occupancyIndex(p);
+    return cell >= 0 && occupancy[cell] > 0;
+}
+
+// Line of sight is symmetric enough here: if the player can see the enemy's cell,
+// the enemy can see the player. A single bit test.
+bool EnemyScheduler::canSeePlayer(const Enemy& enemy) const {
+    return fov && fov->isVisible(enemy.getPosition());
+}
+
+int EnemyScheduler::distanceToPlayer(const Enemy& enemy) const {
+    Position p = enemy.getPosition();
+    return std::abs(p.x - player.x) + std::abs(p.y - player.y);
+}
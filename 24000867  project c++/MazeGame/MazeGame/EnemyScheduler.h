@@ -0,0 +1,132 @@
+#pragma once
+
+#include <coroutine> // C++20 coroutines (enemy behaviors).
+#include <vector>    // For tasks, wakeups and the occupancy grid.
+#include <string>    // For maze data type.
+#include "Position.h"
+#include "TimerWheel.h" // Wakes sleeping enemies.
+
+class Enemy;      // Forward declarations: the scheduler only stores pointers/references.
+class Visibility;
+
+// A running enemy behavior (a C++20 coroutine).
+// Owns the coroutine frame: destroying the task destroys the behavior.
+// Behaviors start suspended; the scheduler decides when they first run.
+class EnemyTask {
+public:
+    struct promise_type {
+        EnemyTask get_return_object() {
+            return EnemyTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception();
+    };
+
+    explicit EnemyTask(std::coroutine_handle<promise_type> h) : handle(h) {}
+    EnemyTask(EnemyTask&& other) noexcept : handle(other.handle) { other.handle = nullptr; }
+    EnemyTask& operator=(EnemyTask&& other) noexcept;
+    ~EnemyTask();
+
+    // Not copyable: exactly one owner per coroutine frame.
+    EnemyTask(const EnemyTask&) = delete;
+    EnemyTask& operator=(const EnemyTask&) = delete;
+
+    std::coroutine_handle<> getHandle() const { return handle; }
+
+private:
+    std::coroutine_handle<promise_type> handle;
+};
+
+// Runs enemy behaviors written as coroutines, e.g.
+//     co_await scheduler.sleep(3);                      // wait three ticks
+//     co_await scheduler.playerWithin(*this, 10);       // wait until the player is close
+// Why a timer wheel: a sleeping enemy sits in the wheel and is not looked at again until
+// it is due. Why buckets: an enemy waiting for the player is filed under the block of the
+// maze it stands in, and each tick only the blocks around the player are checked.
+// Either way a tick only costs work for the enemies near the player or due to act,
+// however many enemies the level has.
+class EnemyScheduler {
+private:
+    static const int BUCKET_SIZE = 16; // Bucket blocks are BUCKET_SIZE x BUCKET_SIZE cells.
+
+    // Where an enemy waiting in playerWithin() is filed.
+    struct Waiting {
+        int radius; // Wake when the player is this close; -1 if not waiting.
+        int bucket; // Index into 'buckets'.
+        int slot;   // Index inside that bucket (for O(1) removal).
+    };
+
+    std::vector<EnemyTask> tasks;          // One behavior per enemy (same index as 'enemies').
+    std::vector<Enemy>* enemies;           // The level's enemies (owned by Game).
+    const std::vector<std::string>* maze;  // The level layout (owned by Game).
+    const Visibility* fov;                 // Player's field of view (owned by Game).
+    Position player;                       // Player position for the current tick.
+
+    TimerWheel<int> wheel;                 // Sleeping enemies (by index), keyed by wake-up tick.
+    std::vector<int> dueNow;               // Scratch list reused every tick.
+    int current;                           // Enemy whose behavior is running right now.
+    int width;                             // Maze width (for the occupancy grid).
+    int height;                            // Maze height.
+    std::vector<int> occupancy;            // Number of enemies on each cell.
+
+    std::vector<std::vector<int>> buckets; // Enemies waiting in playerWithin(), per block.
+    int bucketsWide;                       // Blocks per row.
+    std::vector<Waiting> waiting;          // Per enemy (same index as 'enemies').
+    int maxWaitRadius;                     // Largest radius waited for (sets the area checked per tick).
+
+    void schedule(int enemy, int delay);
+    void park(int enemy, int radius);      // Files 'enemy' under its block until the player is close.
+    void unpark(int enemy);
+    void wakeNearby(std::vector<int>& due); // Appends waiting enemies the player has come close to.
+    int occupancyIndex(const Position& p) const; // -1 if outside the maze.
+
+public:
+    // --- Awaitables used inside behaviors ---
+    struct SleepAwaiter {
+        EnemyScheduler& scheduler;
+        int ticks;
+        bool await_ready() const { return ticks <= 0; }
+        void await_suspend(std::coroutine_handle<>) { scheduler.schedule(scheduler.current, ticks); }
+        void await_resume() const {}
+    };
+
+    struct PlayerWithinAwaiter {
+        EnemyScheduler& scheduler;
+        const Enemy& enemy;
+        int radius;
+        bool await_ready() const;
+        void await_suspend(std::coroutine_handle<>);
+        void await_resume() const {}
+    };
+
+    EnemyScheduler();
+
+    // Suspends the calling behavior for 'ticks' ticks.
+    SleepAwaiter sleep(int ticks);
+
+    // Suspends the calling behavior until the player is within 'radius' steps
+    // (Manhattan distance) of 'enemy'. Does not suspend if they already are.
+    PlayerWithinAwaiter playerWithin(const Enemy& enemy, int radius);
+
+    // Creates one behavior per enemy. All of them first run on the next tick.
+    // 'enemyList' must not be resized until clear() is called.
+    void start(std::vector<Enemy>& enemyList, const std::vector<std::string>& mazeData, const Visibility& view);
+
+    // Destroys all behaviors (call before the enemy list changes).
+    void clear();
+
+    // Advances one tick and resumes every behavior that is due.
+    // Returns the number of behaviors that ran (the "active" enemies).
+    int tick(const Position& playerPos);
+
+    // True if any enemy stands on 'p'. O(1).
+    bool isOccupied(const Position& p) const;
+
+    // --- Queries used inside behaviors ---
+    const std::vector<std::string>& getMaze() const { return *maze; }
+    Position getPlayerPosition() const { return player; }
+    bool canSeePlayer(const Enemy& enemy) const;
+    int distanceToPlayer(const Enemy& enemy) const;
+};
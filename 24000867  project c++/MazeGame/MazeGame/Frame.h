@@ -0,0 +1,21 @@
+#pragma once // Standard include guard.
+
+#include <vector> // For std::vector (grid rows).
+#include <string> // For std::string (one row of display characters).
+
+// Special grid characters used for fog of war.
+// Normal cells keep their maze symbols ('#', ' ', 'P', 'X', 'E', '*').
+const char CELL_UNEXPLORED = '~';      // Never seen this level: drawn blank.
+const char CELL_REMEMBERED_WALL = '%'; // Wall seen before but out of sight now: drawn grey.
+
+// A snapshot of everything shown on screen for one frame.
+// Why a separate struct: the same snapshot is drawn locally and streamed to spectators,
+// so it must not depend on live Game/Player/Enemy objects.
+struct Frame {
+    int level; // Current level number.
+    int score; // Player's score.
+    int moves; // Player's move count.
+    std::vector<std::string> grid; // Maze with entities placed and fog of war applied.
+
+    Frame() : level(0), score(0), moves(0) {}
+};
@@ -0,0 +1,164 @@
+#include "FrameRenderer.h"
+#include <iostream>
+#include <cstdlib>   // For system() [cls/clear]
+#include <sstream>   // Required for std::ostringstream (to format strings for centering)
+
+// --- Platform Specific Includes & Defines ---
+#ifdef _WIN32 // Only include and use for Windows builds
+#define NOMINMAX
+#include <windows.h>
+#endif
+// --- End Platform Specific Includes ---
+
+
+// --- ANSI Escape Codes for Console Colors ---
+// Provide visual feedback directly in the console.
+const std::string ANSI_RESET = "\033[0m";      // Resets all text attributes (color, background)
+const std::string ANSI_BG_MAGENTA = "\033[45m"; // Magenta background for walls
+const std::string ANSI_BG_GREY = "\033[100m";   // Dark grey background for remembered (out of sight) walls
+// Optional: Add more colors if desired
+// const std::string ANSI_FG_YELLOW = "\033[93m"; // Bright Yellow text
+// const std::string ANSI_FG_CYAN = "\033[96m";   // Bright Cyan text
+// const std::string ANSI_FG_RED_BRIGHT = "\033[91m"; // Bright Red text
+// const std::string ANSI_FG_GREEN = "\033[92m";  // Bright Green text
+
+
+// --- Helper function to get console dimensions (Windows specific) ---
+struct ConsoleDimensions {
+    int Width;
+    int Height;
+};
+
+static ConsoleDimensions GetConsoleWindowSize() {
+    ConsoleDimensions dims = { 80, 25 }; // Default values if detection fails
+#ifdef _WIN32
+    HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
+    if (hConsole != INVALID_HANDLE_VALUE) {
+        CONSOLE_SCREEN_BUFFER_INFO csbi;
+        if (GetConsoleScreenBufferInfo(hConsole, &csbi)) {
+            // Use window dimensions for better centering if user resizes window
+            dims.Width = csbi.srWindow.Right - csbi.srWindow.Left + 1;
+            dims.Height = csbi.srWindow.Bottom - csbi.srWindow.Top + 1;
+        }
+    }
+#else
+    // Basic fallback for non-Windows - requires manual adjustment or
+    // using libraries like ncurses or ioctl for Linux/macOS
+    // dims = {80, 24}; // Keep default
+#endif
+    // Ensure minimum width to avoid calculation issues
+    if (dims.Width < 1) dims.Width = 1;
+    return dims;
+}
+// --- End Helper Function ---
+
+
+// Platform-specific screen clearing implementation.
+void FrameRenderer::clearScreen() {
+#ifdef _WIN32
+    system("cls");
+#else
+    system("clear");
+#endif
+}
+
+
+// --- displayFrame function with CENTERED HEADER and Double Width Maze ---
+void FrameRenderer::displayFrame(const Frame& frame) {
+    // 1. Get Console Dimensions
+    ConsoleDimensions consoleSize = GetConsoleWindowSize();
+    int consoleWidth = consoleSize.Width;
+    int consoleHeight = consoleSize.Height;
+
+    // 2. Calculate Content Dimensions (for vertical centering)
+    const int headerLines = 5; // Lines for Title, Score, Moves, Instructions, Blank line
+    const int footerLines = 1; // Blank line at the bottom
+    int mazeHeight = frame.grid.size(); // Number of rows in the maze data
+    int totalContentHeight = headerLines + mazeHeight + footerLines;
+
+    // 3. Calculate Vertical Padding
+    int topPadding = (consoleHeight > totalContentHeight) ? (consoleHeight - totalContentHeight) / 2 : 0;
+
+    // --- Helper Lambda for Centering Text ---
+    // Takes a string and calculates the left padding needed to center it.
+    auto getCenteredIndent = [&](const std::string& text) {
+        int textLength = text.length();
+        int padding = (consoleWidth > textLength) ? (consoleWidth - textLength) / 2 : 0;
+        return std::string(padding, ' ');
+        };
+    // --- End Helper Lambda ---
+
+    // 4. Clear Screen and Apply Top Padding
+    clearScreen();
+    for (int i = 0; i < topPadding; ++i) {
+        std::cout << std::endl;
+    }
+
+    // 5. Print CENTERED Header Information
+    std::string titleText = "--- Maze Game --- Level: " + std::to_string(frame.level) + " ---";
+    std::cout << getCenteredIndent(titleText) << titleText << "\n";
+
+    // Use ostringstream to format score/moves before centering
+    std::ostringstream scoreMovesStream;
+    scoreMovesStream << "Score: " << frame.score << "   Moves: " << frame.moves;
+    std::string scoreMovesText = scoreMovesStream.str();
+    std::cout << getCenteredIndent(scoreMovesText) << scoreMovesText << "\n";
+
+    std::string instructions1 = "Use W, A, S, D to move. Reach 'E' to win! ('Q' to Quit)";
+    std::cout << getCenteredIndent(instructions1) << instructions1 << "\n";
+
+    std::string instructions2 = "'#'=Wall(Magenta Block), ' '=Path, '*'=Collectible, 'X'=Enemy, 'P'=Player, 'E'=Exit";
+    std::cout << getCenteredIndent(instructions2) << instructions2 << "\n";
+
+    std::cout << "\n"; // Blank line after instructions
+
+
+    // 6. Print the Maze (Centered Horizontally, Double Width)
+    if (frame.grid.empty() || frame.grid[0].empty()) {
+        std::cout << getCenteredIndent("(Error: Maze data is empty)") << "(Error: Maze data is empty)\n";
+        return;
+    }
+
+    int mazeDataWidth = frame.grid[0].size();
+    int mazeDisplayWidth = mazeDataWidth * 2; // Double width for display
+    int leftPaddingMaze = (consoleWidth > mazeDisplayWidth) ? (consoleWidth - mazeDisplayWidth) / 2 : 0;
+    std::string mazeIndent(leftPaddingMaze, ' ');
+
+    // Iterate and print MAZE character by character with colors AND DOUBLE WIDTH
+    for (const auto& row : frame.grid) {
+        std::cout << mazeIndent; // Apply left padding for the maze row
+        for (char cell : row) {
+            // Check the character and print TWO characters for each cell
+            switch (cell) {
+            case '#': // Wall
+                std::cout << ANSI_BG_MAGENTA << "  " << ANSI_RESET; // Magenta background, TWO spaces
+                break;
+            case CELL_REMEMBERED_WALL: // Wall out of sight (fog of war)
+                std::cout << ANSI_BG_GREY << "  " << ANSI_RESET;
+                break;
+            case 'P': // Player
+                std::cout << " P"; // Space then P (adjust as desired: "P ", "PP")
+                break;
+            case 'X': // Enemy
+                std::cout << " X"; // Space then X
+                break;
+            case 'E': // Exit
+                std::cout << " E"; // Space then E
+                break;
+            case '*': // Collectible
+                std::cout << " *"; // Space then *
+                break;
+            case ' ': // Path
+            case CELL_UNEXPLORED: // Not seen yet (fog of war)
+                std::cout << "  "; // Two spaces
+                break;
+            default:  // Any other unexpected characters
+                std::cout << cell << ' '; // Print char and a space
+                break;
+            }
+        }
+        std::cout << std::endl; // Newline after printing all characters in a row
+    }
+    std::cout << std::endl; // Add final blank line (footer)
+}
+// --- End displayFrame function ---
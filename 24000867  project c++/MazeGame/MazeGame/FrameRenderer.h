@@ -0,0 +1,15 @@
+#pragma once // Standard include guard.
+
+#include "Frame.h" // The snapshot being drawn.
+
+// Draws Frames to the console.
+// Why a separate class: both the game and spectator viewers draw the same Frames, and
+// neither should have to include the other to do it. Static only: holds no state.
+class FrameRenderer {
+public:
+    // Clears the console screen (platform-dependent).
+    static void clearScreen();
+
+    // Draws one frame centred in the console, walls as coloured blocks, cells double width.
+    static void displayFrame(const Frame& frame);
+};
@@ -1,62 +1,24 @@
 #include "Game.h"
+#include "Solver.h"  // For printSolutions()
+#include "FrameRenderer.h" // For drawing frames to the console.
 #include <iostream>
 #include <fstream>
-#include <conio.h>   // For _getch() [Windows specific non-blocking input]
-#include <cstdlib>   // For system() [cls/clear]
+#include <conio.h>   // For _getch()/_kbhit() [Windows specific non-blocking input]
 #include <vector>
 #include <string>
 #include <thread>    // Required for std::this_thread::sleep_for [pausing]
 #include <chrono>    // Required for std::chrono::seconds [pausing]
 #include <cctype>    // Required for toupper()
-#include <sstream>   // Required for std::ostringstream (to format strings for centering)
-
-// --- Platform Specific Includes & Defines ---
-#ifdef _WIN32 // Only include and use for Windows builds
-#define NOMINMAX
-#include <windows.h>
-#endif
-// --- End Platform Specific Includes ---
-
-
-// --- ANSI Escape Codes for Console Colors ---
-// Provide visual feedback directly in the console.
-const std::string ANSI_RESET = "\033[0m";      // Resets all text attributes (color, background)
-const std::string ANSI_BG_MAGENTA = "\033[45m"; // Magenta background for walls
-// Optional: Add more colors if desired
-// const std::string ANSI_FG_YELLOW = "\033[93m"; // Bright Yellow text
-// const std::string ANSI_FG_CYAN = "\033[96m";   // Bright Cyan text
-// const std::string ANSI_FG_RED_BRIGHT = "\033[91m"; // Bright Red text
-// const std::string ANSI_FG_GREEN = "\033[92m";  // Bright Green text
-
-
-// --- Helper function to get console dimensions (Windows specific) ---
-struct ConsoleDimensions {
-    int Width;
-    int Height;
-};
-
-ConsoleDimensions GetConsoleWindowSize() {
-    ConsoleDimensions dims = { 80, 25 }; // Default values if detection fails
-#ifdef _WIN32
-    HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
-    if (hConsole != INVALID_HANDLE_VALUE) {
-        CONSOLE_SCREEN_BUFFER_INFO csbi;
-        if (GetConsoleScreenBufferInfo(hConsole, &csbi)) {
-            // Use window dimensions for better centering if user resizes window
-            dims.Width = csbi.srWindow.Right - csbi.srWindow.Left + 1;
-            dims.Height = csbi.srWindow.Bottom - csbi.srWindow.Top + 1;
-        }
-    }
-#else
-    // Basic fallback for non-Windows - requires manual adjustment or
-    // using libraries like ncurses or ioctl for Linux/macOS
-    // dims = {80, 24}; // Keep default
-#endif
-    // Ensure minimum width to avoid calculation issues
-    if (dims.Width < 1) dims.Width = 1;
-    return dims;
-}
-// --- End Helper Function ---
+#include <cmath>     // Required for std::sqrt (tick jitter)
+#include <random>    // Required for std::mt19937 (scripted input)
+#include <algorithm> // Required for std::nth_element (percentiles)
+
+// Leaderboard file, shared by every game process started from the same directory.
+const std::string HIGH_SCORE_FILE = "highscores.dat";
+
+// Scripted input (--scripted-input): one key every SCRIPTED_KEY_INTERVAL_MS, from a fixed seed.
+const int SCRIPTED_KEY_INTERVAL_MS = 10;
+const unsigned SCRIPTED_INPUT_SEED = 2026;
 
 
 // Constructor Implementation
@@ -68,18 +30,21 @@ Game::Game(int numberOfLevels)
     gameOver(false),        // Game not over initially
     playerWonLevel(false),  // Haven't won yet
     playerLost(false),      // Haven't lost yet
-    exitPos(-1, -1)         // Initialize exitPos to an invalid state until level loaded
+    exitPos(-1, -1),        // Initialize exitPos to an invalid state until level loaded
+    startAndExitFound(false),
+    inputRunning(false),    // Pipeline threads start in run()
+    renderRunning(false),
+    renderDelayMs(0),       // Draw as fast as the terminal allows
+    scriptedTicks(0),       // Keys come from the keyboard
+    ticks(0), tickSeconds(0.0), tickSquaredSeconds(0.0), tickMaxSeconds(0.0),
+    framesDrawn(0), framesSkipped(0), latencySeconds(0.0), latencyMaxSeconds(0.0)
 {
     // Constructor body can be empty if all initialization is done above.
 }
 
-// Platform-specific screen clearing implementation.
-void Game::clearScreen() const {
-#ifdef _WIN32
-    system("cls");
-#else
-    system("clear");
-#endif
+// Starts listening for spectators.
+bool Game::enableSpectators(const std::string& socketPath) {
+    return spectators.start(socketPath);
 }
 
 // Loads maze data and initializes level state from a text file.
@@ -93,6 +58,7 @@ bool Game::loadLevel(int levelNumber) {
     }
 
     maze.clear();
+    enemyScheduler.clear(); // Behaviors point at the old enemies; drop them first.
     enemies.clear();
     player.reset();
     gameOver = false;
@@ -111,9 +77,14 @@ bool Game::loadLevel(int levelNumber) {
         return false;
     }
 
-    findStartPositions();
+    startAndExitFound = findStartPositions();
+
+    // Walls are fixed for the whole level, so pack them once and compute the first view.
+    fov.build(maze);
+    fov.update(player.getPosition());
+    enemyScheduler.start(enemies, maze, fov);
 
-    if (player.getPosition() == Position(-1, -1) || exitPos == Position(-1, -1)) {
+    if (!startAndExitFound) {
         std::cerr << "Warning: Player 'P' or Exit 'E' not found in " << filename << ". Level might be unplayable." << std::endl;
     }
 
@@ -122,7 +93,8 @@ bool Game::loadLevel(int levelNumber) {
 }
 
 // Finds starting positions of 'P', 'E', 'X' in the maze data.
-void Game::findStartPositions() {
+// Returns false if 'P' or 'E' is missing.
+bool Game::findStartPositions() {
     Position playerStart(-1, -1);
 
     for (int y = 0; y < maze.size(); ++y) {
@@ -149,132 +121,74 @@ void Game::findStartPositions() {
         player.setPosition(0, 0);
         std::cerr << "Error: Player 'P' start position not found in level data!" << std::endl;
     }
+    return playerStart != Position(-1, -1) && exitPos != Position(-1, -1);
 }
 
 
-// --- displayMaze function with CENTERED HEADER and Double Width Maze ---
-void Game::displayMaze() const {
-    // 1. Get Console Dimensions
-    ConsoleDimensions consoleSize = GetConsoleWindowSize();
-    int consoleWidth = consoleSize.Width;
-    int consoleHeight = consoleSize.Height;
-
-    // 2. Calculate Content Dimensions (for vertical centering)
-    const int headerLines = 5; // Lines for Title, Score, Moves, Instructions, Blank line
-    const int footerLines = 1; // Blank line at the bottom
-    int mazeHeight = maze.size(); // Number of rows in the maze data
-    int totalContentHeight = headerLines + mazeHeight + footerLines;
-
-    // 3. Calculate Vertical Padding
-    int topPadding = (consoleHeight > totalContentHeight) ? (consoleHeight - totalContentHeight) / 2 : 0;
-
-    // --- Helper Lambda for Centering Text ---
-    // Takes a string and calculates the left padding needed to center it.
-    auto getCenteredIndent = [&](const std::string& text) {
-        int textLength = text.length();
-        int padding = (consoleWidth > textLength) ? (consoleWidth - textLength) / 2 : 0;
-        return std::string(padding, ' ');
-        };
-    // --- End Helper Lambda ---
-
-    // 4. Clear Screen and Apply Top Padding
-    clearScreen();
-    for (int i = 0; i < topPadding; ++i) {
-        std::cout << std::endl;
-    }
-
-    // 5. Print CENTERED Header Information
-    std::string titleText = "--- Maze Game --- Level: " + std::to_string(currentLevel) + " ---";
-    std::cout << getCenteredIndent(titleText) << titleText << "\n";
-
-    // Use ostringstream to format score/moves before centering
-    std::ostringstream scoreMovesStream;
-    scoreMovesStream << "Score: " << player.getScore() << "   Moves: " << player.getMoves();
-    std::string scoreMovesText = scoreMovesStream.str();
-    std::cout << getCenteredIndent(scoreMovesText) << scoreMovesText << "\n";
+// Builds a snapshot of the current screen contents.
+// Entities are placed onto a copy of the maze and fog of war is applied,
+// so the result can be drawn without access to the live game objects.
+Frame Game::captureFrame() const {
+    Frame frame;
+    frame.level = currentLevel;
+    frame.score = player.getScore();
+    frame.moves = player.getMoves();
 
-    std::string instructions1 = "Use W, A, S, D to move. Reach 'E' to win! ('Q' to Quit)";
-    std::cout << getCenteredIndent(instructions1) << instructions1 << "\n";
-
-    std::string instructions2 = "'#'=Wall(Magenta Block), ' '=Path, '*'=Collectible, 'X'=Enemy, 'P'=Player, 'E'=Exit";
-    std::cout << getCenteredIndent(instructions2) << instructions2 << "\n";
-
-    std::cout << "\n"; // Blank line after instructions
-
-
-    // 6. Prepare and Print the Maze (Centered Horizontally, Double Width)
     if (maze.empty() || maze[0].empty()) {
-        std::cout << getCenteredIndent("(Error: Maze data is empty)") << "(Error: Maze data is empty)\n";
-        return;
+        return frame; // Empty grid: FrameRenderer::displayFrame() reports the error.
     }
 
     int mazeDataWidth = maze[0].size();
-    int mazeDisplayWidth = mazeDataWidth * 2; // Double width for display
-    int leftPaddingMaze = (consoleWidth > mazeDisplayWidth) ? (consoleWidth - mazeDisplayWidth) / 2 : 0;
-    std::string mazeIndent(leftPaddingMaze, ' ');
-
-
-    std::vector<std::string> displayGrid = maze; // Start with base layout
+    std::vector<std::string>& displayGrid = frame.grid;
+    displayGrid = maze; // Start with base layout
 
-    // Place dynamic entities onto the displayGrid (same logic as before)
+    // Place dynamic entities onto the displayGrid
     Position pPos = player.getPosition();
     if (pPos.y >= 0 && pPos.y < displayGrid.size() && pPos.x >= 0 && pPos.x < mazeDataWidth) {
         displayGrid[pPos.y][pPos.x] = player.getSymbol();
     }
     for (const auto& enemy : enemies) {
         Position ePos = enemy.getPosition();
+        if (!fov.isVisible(ePos)) {
+            continue; // Enemies hidden by walls or distance are not drawn (fog of war).
+        }
         if (ePos.y >= 0 && ePos.y < displayGrid.size() && ePos.x >= 0 && ePos.x < mazeDataWidth) {
             if (displayGrid[ePos.y][ePos.x] != player.getSymbol()) {
                 displayGrid[ePos.y][ePos.x] = enemy.getSymbol();
             }
         }
     }
-    if (exitPos.y >= 0 && exitPos.y < displayGrid.size() && exitPos.x >= 0 && exitPos.x < mazeDataWidth) {
+    if (exitPos.y >= 0 && exitPos.y < displayGrid.size() && exitPos.x >= 0 && exitPos.x < mazeDataWidth &&
+        fov.isExplored(exitPos.x, exitPos.y)) {
         char currentCell = displayGrid[exitPos.y][exitPos.x];
         if (currentCell != player.getSymbol() && currentCell != 'X') {
             displayGrid[exitPos.y][exitPos.x] = 'E';
         }
     }
 
-    // Iterate and print MAZE character by character with colors AND DOUBLE WIDTH
-    for (const auto& row : displayGrid) {
-        std::cout << mazeIndent; // Apply left padding for the maze row
-        for (char cell : row) {
-            // Check the character and print TWO characters for each cell
-            switch (cell) {
-            case '#': // Wall
-                std::cout << ANSI_BG_MAGENTA << "  " << ANSI_RESET; // Magenta background, TWO spaces
-                break;
-            case 'P': // Player
-                std::cout << " P"; // Space then P (adjust as desired: "P ", "PP")
-                break;
-            case 'X': // Enemy
-                std::cout << " X"; // Space then X
-                break;
-            case 'E': // Exit
-                std::cout << " E"; // Space then E
-                break;
-            case '*': // Collectible
-                std::cout << " *"; // Space then *
-                break;
-            case ' ': // Path
-                std::cout << "  "; // Two spaces for path
-                break;
-            default:  // Any other unexpected characters
-                std::cout << cell << ' '; // Print char and a space
-                break;
+    // Fog of war: never-seen cells stay blank, remembered cells show terrain only.
+    for (int y = 0; y < displayGrid.size(); ++y) {
+        for (int x = 0; x < displayGrid[y].size(); ++x) {
+            if (!fov.isExplored(x, y)) {
+                displayGrid[y][x] = CELL_UNEXPLORED;
+            }
+            else if (!fov.isVisible(x, y) && displayGrid[y][x] == '#') {
+                displayGrid[y][x] = CELL_REMEMBERED_WALL;
             }
         }
-        std::cout << std::endl; // Newline after printing all characters in a row
     }
-    std::cout << std::endl; // Add final blank line (footer)
+    return frame;
 }
-// --- End displayMaze function ---
 
+// Captures the current frame, streams it to any spectators and draws it locally.
+void Game::displayMaze() const {
+    Frame frame = captureFrame();
+    spectators.broadcast(frame); // Encoded once, no matter how many viewers are attached.
+    FrameRenderer::displayFrame(frame);
+}
 
-// Handles player keyboard input.
-void Game::handleInput() {
-    char input = _getch();
+// Handles one key press from the player.
+void Game::handleInput(char input) {
     char direction = std::toupper(input);
 
     if (direction == 'W' || direction == 'A' || direction == 'S' || direction == 'D') {
@@ -288,6 +202,7 @@ void Game::handleInput() {
                 player.increaseScore(10);
                 maze[newPos.y][newPos.x] = ' ';
             }
+            fov.update(newPos); // Recompute what the player can see from the new cell.
         }
     }
     else if (direction == 'Q') {
@@ -298,18 +213,16 @@ void Game::handleInput() {
 
 // Updates game state after player input, e.g., enemy movement, collision checks.
 void Game::updateGame() {
-    for (auto& enemy : enemies) {
-        enemy.moveRandomly(maze);
-    }
-
     Position playerPos = player.getPosition();
 
-    for (const auto& enemy : enemies) {
-        if (playerPos == enemy.getPosition()) {
-            gameOver = true;
-            playerLost = true;
-            return;
-        }
+    // Only enemies whose behavior is due this tick run (see Enemy::behave()).
+    // Sleeping and distant enemies cost nothing here.
+    enemyScheduler.tick(playerPos);
+
+    if (enemyScheduler.isOccupied(playerPos)) {
+        gameOver = true;
+        playerLost = true;
+        return;
     }
 
     if (playerPos == exitPos) {
@@ -319,13 +232,214 @@ void Game::updateGame() {
     }
 }
 
+// Prints the par (minimum) moves and route for every level.
+void Game::printSolutions() {
+    for (int level = 1; level <= maxLevels; ++level) {
+        if (!loadLevel(level)) {
+            break;
+        }
+        if (!startAndExitFound) {
+            std::cout << "Level " << level << ": skipped ('P' or 'E' is missing)\n";
+            continue;
+        }
+        Solution solution = Solver::solve(maze, player.getPosition(), exitPos);
+        std::cout << "Level " << level << ": ";
+        if (!solution.solved) {
+            std::cout << "not solvable (exit or a collectible cannot be reached)\n";
+            continue;
+        }
+        bool valid = Solver::verify(maze, player.getPosition(), exitPos, solution.path);
+        std::cout << "par " << solution.moves << " moves"
+            << (solution.optimal ? " (optimal)" : " (heuristic)")
+            << (valid ? "" : " [REPLAY FAILED]") << "\n  " << solution.path << "\n";
+    }
+}
+
+void Game::printLeaderboard(int level, int count) const {
+    std::vector<HighScore> best = highScores.top(level, count);
+    std::cout << "--- Level " << level << " High Scores ---\n";
+    if (best.empty()) {
+        std::cout << "  (no scores yet)\n";
+    }
+    for (size_t i = 0; i < best.size(); ++i) {
+        std::cout << "  " << (i + 1) << ". Score: " << best[i].score << "   Moves: " << best[i].moves << "\n";
+    }
+}
+
+// Prints all leaderboards plus the shared update counters.
+void Game::printHighScores() {
+    if (!highScores.isOpen() && !highScores.open(HIGH_SCORE_FILE)) {
+        return;
+    }
+    for (int level = 1; level <= maxLevels && level <= HighScoreStore::MAX_LEVELS; ++level) {
+        printLeaderboard(level, HighScoreStore::TOP_K);
+        HighScoreStore::Stats stats = highScores.getStats(level);
+        std::cout << "  (" << stats.submissions << " submitted, " << stats.updates << " accepted, "
+            << stats.casRetries << " CAS retries)\n";
+    }
+}
+
+void Game::setRenderDelay(int milliseconds) {
+    renderDelayMs = milliseconds;
+}
+
+void Game::setScriptedInput(int ticks) {
+    scriptedTicks = ticks;
+}
+
+// --- Pipeline ---
+
+// Input thread: reads the keyboard and queues keys for the simulation.
+// Polls with _kbhit() so it can notice the stop flag instead of blocking forever in _getch().
+void Game::inputLoop() {
+    while (inputRunning.load()) {
+        if (!_kbhit()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+        KeyEvent event;
+        event.key = char(_getch());
+        event.time = std::chrono::steady_clock::now();
+        while (!keyQueue.push(event) && inputRunning.load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1)); // Queue full: wait, never drop keys.
+        }
+    }
+}
+
+// Scripted input thread: presses a random W/A/S/D (fixed seed) every SCRIPTED_KEY_INTERVAL_MS,
+// like a player holding the keys down. A key is only pressed once the previous one has
+// been taken, so keys never pile up in the queue (e.g. during "press any key" pauses)
+// and inflate the latency numbers; a beat the simulation is not ready for is skipped.
+void Game::scriptedInputLoop() {
+    std::mt19937 rng(SCRIPTED_INPUT_SEED);
+    std::uniform_int_distribution<int> direction(0, 3);
+    const char moves[4] = { 'W', 'A', 'S', 'D' };
+
+    auto next = std::chrono::steady_clock::now();
+    while (inputRunning.load()) {
+        next += std::chrono::milliseconds(SCRIPTED_KEY_INTERVAL_MS);
+        std::this_thread::sleep_until(next);
+        if (next < std::chrono::steady_clock::now()) {
+            next = std::chrono::steady_clock::now(); // Fell behind: keep the rate, do not burst.
+        }
+        if (!keyQueue.empty()) {
+            continue;
+        }
+        KeyEvent event;
+        event.key = moves[direction(rng)];
+        event.time = std::chrono::steady_clock::now();
+        keyQueue.push(event);
+    }
+}
+
+// Render thread: draws the newest published frame. If frames arrive faster than the
+// terminal can draw them, the older ones are skipped rather than queued up.
+void Game::renderLoop() {
+    while (renderRunning.load()) {
+        if (!frames.update()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+        const FrameState& state = frames.readSlot();
+        spectators.broadcast(state.frame); // Spectator sockets are also kept off the simulation thread.
+        if (renderDelayMs > 0) {
+            // Simulated slow terminal: the frame only reaches the screen after the delay.
+            std::this_thread::sleep_for(std::chrono::milliseconds(renderDelayMs));
+        }
+        FrameRenderer::displayFrame(state.frame);
+        std::cout.flush();
+
+        // The frame is on screen now: measure from the key press to here.
+        double latency = std::chrono::duration<double>(std::chrono::steady_clock::now() - state.inputTime).count();
+        latencySeconds += latency;
+        latencySamples.push_back(latency);
+        if (latency > latencyMaxSeconds) {
+            latencyMaxSeconds = latency;
+        }
+        framesDrawn++;
+    }
+}
+
+// Takes the next key queued by the input thread, waiting if there is none yet.
+KeyEvent Game::waitForKey() {
+    KeyEvent event;
+    while (!keyQueue.pop(event)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return event;
+}
+
+// Captures the current state and hands it to the render thread. Never blocks.
+void Game::publishFrame(std::chrono::steady_clock::time_point inputTime) {
+    FrameState& state = frames.writeSlot();
+    state.frame = captureFrame();
+    state.inputTime = inputTime;
+    frames.publish();
+}
+
+void Game::stopInputThread() {
+    inputRunning = false;
+    if (inputThread.joinable()) {
+        inputThread.join();
+    }
+}
+
+// Value below which 'fraction' of the samples lie (e.g. 0.99 for the 99th percentile).
+static double percentile(std::vector<double> samples, double fraction) {
+    if (samples.empty()) {
+        return 0.0;
+    }
+    size_t index = size_t(fraction * (samples.size() - 1));
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return samples[index];
+}
+
+// Prints simulation tick cost/jitter and key-to-screen latency.
+void Game::printPipelineStats() const {
+    std::cout << "\n--- Pipeline Statistics ---\n";
+    if (scriptedTicks > 0) {
+        std::cout << "Input: scripted, one key every " << SCRIPTED_KEY_INTERVAL_MS << " ms; render delay "
+            << renderDelayMs << " ms\n";
+    }
+    if (ticks > 0) {
+        double mean = tickSeconds / ticks;
+        double variance = tickSquaredSeconds / ticks - mean * mean;
+        double jitter = std::sqrt(variance > 0.0 ? variance : 0.0);
+        std::cout << "Simulation ticks: " << ticks << ", mean " << mean * 1e6 << " us, p50 "
+            << percentile(tickSamples, 0.5) * 1e6 << " us, p99 " << percentile(tickSamples, 0.99) * 1e6
+            << " us, max " << tickMaxSeconds * 1e6 << " us, jitter (std dev) " << jitter * 1e6 << " us\n";
+    }
+    if (framesDrawn > 0) {
+        std::cout << "Frames drawn: " << framesDrawn << ", skipped: " << framesSkipped
+            << ", key-to-screen latency mean " << latencySeconds / framesDrawn * 1e3
+            << " ms, p50 " << percentile(latencySamples, 0.5) * 1e3
+            << " ms, p99 " << percentile(latencySamples, 0.99) * 1e3
+            << " ms, max " << latencyMaxSeconds * 1e3 << " ms\n";
+        if (scriptedTicks == 0) {
+            // Keys are stamped when the input thread reads them; its 1 ms _kbhit() poll happens
+            // before that, so up to ~1 ms per key is not in these numbers. The simulation's and
+            // the renderer's 1 ms polls happen after the stamp and are included.
+            std::cout << "(Latency excludes up to ~1 ms of keyboard polling before each key is stamped.)\n";
+        }
+    }
+}
+
 // The main execution function that orchestrates the game flow.
 void Game::run() {
+    // Without the shared file the game still works, it just has no leaderboard.
+    if (!highScores.isOpen()) {
+        highScores.open(HIGH_SCORE_FILE);
+    }
+
+    inputRunning = true;
+    inputThread = std::thread(scriptedTicks > 0 ? &Game::scriptedInputLoop : &Game::inputLoop, this);
+
     while (currentLevel <= maxLevels) {
         if (!loadLevel(currentLevel)) {
             std::cerr << "Critical Error: Failed to load level " << currentLevel << ". Exiting game." << std::endl;
             std::cout << "Press any key to exit." << std::endl;
-            _getch();
+            waitForKey();
+            stopInputThread();
             return;
         }
 
@@ -333,25 +447,68 @@ void Game::run() {
         playerWonLevel = false;
         playerLost = false;
 
+        // Play the level: the render thread draws while this thread only simulates.
+        long long framesPublished = 0;
+        long long framesDrawnBefore = framesDrawn;
+        publishFrame(std::chrono::steady_clock::now());
+        framesPublished++;
+        renderRunning = true;
+        renderThread = std::thread(&Game::renderLoop, this);
+
         while (!gameOver) {
-            displayMaze();
-            handleInput();
+            KeyEvent event = waitForKey();
+
+            auto tickStart = std::chrono::steady_clock::now();
+            handleInput(event.key);
             if (!gameOver) {
                 updateGame();
             }
+            publishFrame(event.time);
+            framesPublished++;
+
+            double tick = std::chrono::duration<double>(std::chrono::steady_clock::now() - tickStart).count();
+            ticks++;
+            tickSeconds += tick;
+            tickSquaredSeconds += tick * tick;
+            tickSamples.push_back(tick);
+            if (tick > tickMaxSeconds) {
+                tickMaxSeconds = tick;
+            }
+            if (scriptedTicks > 0 && ticks >= scriptedTicks) {
+                gameOver = true; // Scripted run complete.
+            }
+        }
+
+        renderRunning = false;
+        renderThread.join(); // The render thread is idle from here on; it is safe to print again.
+        // The last frame is drawn again below, so it does not count as skipped.
+        long long skipped = framesPublished - (framesDrawn - framesDrawnBefore) - 1;
+        if (skipped > 0) {
+            framesSkipped += skipped;
         }
 
         displayMaze(); // Show final state
 
+        if (scriptedTicks > 0 && ticks >= scriptedTicks) {
+            std::cout << "\nScripted input finished after " << ticks << " ticks.\n";
+            break;
+        }
+
         if (playerWonLevel) {
             std::cout << "\n*******************************\n";
             std::cout << "*      Level " << currentLevel << " Cleared!      *\n";
             std::cout << "*******************************\n";
+            if (highScores.isOpen()) {
+                if (highScores.submit(currentLevel, player.getScore(), player.getMoves())) {
+                    std::cout << "New high score!\n";
+                }
+                printLeaderboard(currentLevel, 5);
+            }
             std::this_thread::sleep_for(std::chrono::seconds(2));
 
             if (currentLevel < maxLevels) {
                 std::cout << "Press any key to start Level " << (currentLevel + 1) << "..." << std::endl;
-                _getch();
+                waitForKey();
                 currentLevel++;
             }
             else {
@@ -362,6 +519,9 @@ void Game::run() {
                 break;
             }
         }
+        else if (playerLost && scriptedTicks > 0) {
+            std::cout << "\n(Scripted run: caught after " << ticks << " ticks, replaying the level.)\n";
+        }
         else if (playerLost) {
             std::cout << "\n!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!\n";
             std::cout << "!          GAME OVER              !\n";
@@ -371,7 +531,13 @@ void Game::run() {
         }
     } // End of outer game loop
 
+    spectators.printStats(std::cout); // Only prints if spectating was enabled.
+    if (renderDelayMs > 0 || scriptedTicks > 0) {
+        printPipelineStats();
+    }
+
     std::cout << "\nThanks for playing!\n";
     std::cout << "Press any key to exit." << std::endl;
-    _getch();
+    waitForKey();
+    stopInputThread();
 }
\ No newline at end of file
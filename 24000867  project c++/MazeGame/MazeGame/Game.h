@@ -4,7 +4,29 @@
 #include <string>   // For std::string (maze rows).
 #include "Player.h" // Include Player class definition.
 #include "Enemy.h"  // Include Enemy class definition.
+#include "EnemyScheduler.h" // Runs enemy behaviors.
 #include "Position.h" // Include Position struct definition.
+#include "Visibility.h" // Include the field-of-view / fog of war subsystem.
+#include "Frame.h"    // Include the screen snapshot drawn locally and streamed to spectators.
+#include "Spectator.h" // Include spectator streaming.
+#include "SpscRing.h"  // Lock-free key queue (input thread -> simulation thread).
+#include "TripleBuffer.h" // Lock-free frame handoff (simulation thread -> render thread).
+#include "HighScores.h" // Shared per-level leaderboards.
+#include <thread>   // For the input and render threads.
+#include <atomic>   // For the thread stop flags.
+#include <chrono>   // For input timestamps and pipeline timings.
+
+// A key press, stamped when the input thread read it (for end-to-end latency).
+struct KeyEvent {
+    char key;
+    std::chrono::steady_clock::time_point time;
+};
+
+// A finished frame handed to the render thread, plus the time of the key that caused it.
+struct FrameState {
+    Frame frame;
+    std::chrono::steady_clock::time_point inputTime;
+};
 
 // Manages the overall game state, logic, and interaction.
 // Acts as the central controller for the maze game.
@@ -14,24 +36,68 @@ private:
     std::vector<std::string> maze; // Stores the static layout of the current level (walls, paths, original collectible locations).
     Player player;                 // The player object (contains position, score, moves).
     std::vector<Enemy> enemies;    // A list holding all enemy objects for the current level.
+    EnemyScheduler enemyScheduler; // Resumes enemy behaviors only when they are due.
     Position exitPos;              // Coordinates of the level's exit 'E'.
+    bool startAndExitFound;        // False if the loaded level has no 'P' or no 'E'.
+    Visibility fov;                // Player's field of view; drives enemy detection and fog of war.
+    // Spectator streaming. 'mutable' because sending a frame to viewers is not game state
+    // and happens from the const displayMaze().
+    mutable Spectator spectators;
     int currentLevel;              // Tracks the current level number (e.g., 1, 2, ...).
     int maxLevels;                 // The total number of levels available.
     bool gameOver;                 // Flag indicating if the current level loop should end (due to win, loss, or quit).
     bool playerWonLevel;           // Flag set specifically when the player reaches the exit.
     bool playerLost;               // Flag set specifically when the player collides with an enemy or quits.
+    HighScoreStore highScores;     // Leaderboards shared with every other game process on this machine.
+
+    // --- Pipeline (input thread -> simulation -> render thread) ---
+    // Why threads: a slow terminal must not slow the simulation. The simulation runs on
+    // the calling thread and never writes to stdout while a level is being played.
+    SpscRing<KeyEvent, 64> keyQueue;   // Keys read by the input thread, waiting for the simulation.
+    TripleBuffer<FrameState> frames;   // Newest frame for the render thread.
+    std::thread inputThread;           // Reads the keyboard for the whole run().
+    std::thread renderThread;          // Draws frames while a level is being played.
+    std::atomic<bool> inputRunning;    // Cleared to stop the input thread.
+    std::atomic<bool> renderRunning;   // Cleared to stop the render thread.
+    int renderDelayMs;                 // Artificial delay per drawn frame (simulates a slow terminal).
+    int scriptedTicks;                 // If > 0: keys come from scriptedInputLoop() and play stops after this many ticks.
+
+    // --- Pipeline Statistics ---
+    long long ticks;           // Simulation ticks (one per key press during play).
+    double tickSeconds;        // Total time spent in simulation ticks.
+    double tickSquaredSeconds; // Sum of squared tick times (for jitter).
+    double tickMaxSeconds;     // Slowest tick.
+    long long framesDrawn;     // Frames drawn by the render thread (written only by it).
+    long long framesSkipped;   // Frames published but replaced before the render thread drew them.
+    double latencySeconds;     // Total key-to-screen latency of drawn frames.
+    double latencyMaxSeconds;  // Worst key-to-screen latency.
+    std::vector<double> tickSamples;    // Every tick's duration (for percentiles).
+    std::vector<double> latencySamples; // Every drawn frame's latency (written only by the render thread).
 
     // --- Private Helper Methods ---
     // Encapsulate internal logic, not meant to be called directly from outside the Game class.
 
-    // Clears the console screen (platform-dependent). Marked 'const'.
-    void clearScreen() const;
+    // Builds a snapshot of the maze with player, enemies, exit and fog of war applied.
+    Frame captureFrame() const;
 
-    // Renders the current state of the maze, player, enemies, etc., to the console. Marked 'const'.
+    // Renders the current state of the maze, player, enemies, etc., to the console
+    // and to any connected spectators. Marked 'const'.
     void displayMaze() const;
 
-    // Handles reading player input from the keyboard.
-    void handleInput();
+    // Applies one key press from the player.
+    void handleInput(char input);
+
+    // --- Pipeline Helpers ---
+    void inputLoop();               // Body of the input thread.
+    void scriptedInputLoop();       // Body of the input thread when input is scripted.
+    void renderLoop();              // Body of the render thread.
+    KeyEvent waitForKey();          // Takes the next key from the input thread (waits if none).
+    void publishFrame(std::chrono::steady_clock::time_point inputTime); // Hands a new frame to the renderer.
+    void stopInputThread();         // Stops and joins the input thread.
+    void printPipelineStats() const;
+
+    // Prints the leaderboard for one level.
+    void printLeaderboard(int level, int count) const;
 
     // Updates the game state after player input (e.g., moves enemies, checks for collisions).
     void updateGame();
@@ -42,7 +108,8 @@ private:
 
     // Scans the loaded maze data to find initial positions of 'P', 'E', 'X'
     // and configures the player/enemies/exitPos accordingly.
-    void findStartPositions();
+    // Returns false if 'P' or 'E' is missing.
+    bool findStartPositions();
 
 public:
     // --- Public Interface ---
@@ -53,6 +120,26 @@ public:
     // Starts and manages the main game loop, coordinating level loading and gameplay.
     void run();
 
+    // Solves every level (shortest route from 'P' through all '*' to 'E') and prints
+    // the par move count and a replayable move string for each one.
+    void printSolutions();
+
+    // Prints every level's leaderboard and how contended the shared score file has been.
+    void printHighScores();
+
+    // Delays every frame by 'milliseconds' before it is drawn to simulate a slow output sink, and prints
+    // simulation tick jitter and key-to-screen latency when the game ends.
+    void setRenderDelay(int milliseconds);
+
+    // Replaces the keyboard with a fixed-rate, fixed-seed key script and stops after
+    // 'ticks' simulation ticks, so pipeline timings can be measured unattended.
+    // A lost level is replayed until the ticks are used up.
+    void setScriptedInput(int ticks);
+
+    // Lets other terminals watch this game through a Unix domain socket at 'socketPath'.
+    // Returns false if the socket could not be created.
+    bool enableSpectators(const std::string& socketPath);
+
     // Potential future methods (not implemented based on current spec):
     // void saveGameState(const std::string& filename); // Saves player pos, score, level etc.
     // void loadGameState(const std::string& filename); // Loads a saved game state.
@@ -0,0 +1,221 @@
+#include "HighScores.h"
+#include <iostream>
+#include <algorithm> // For std::sort.
+
+// --- Platform Specific Includes ---
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+// --- End Platform Specific Includes ---
+
+const std::uint32_t FILE_MAGIC = 0x53485A4D; // "MZHS" (little-endian).
+const std::uint32_t LAYOUT_VERSION = 2;       // Version 2: one packed header word.
+
+// The header every compatible file starts with (see FileLayout::header).
+const std::uint64_t FILE_HEADER = std::uint64_t(FILE_MAGIC)
+    | (std::uint64_t(LAYOUT_VERSION) << 32)
+    | (std::uint64_t(HighScoreStore::MAX_LEVELS) << 40)
+    | (std::uint64_t(HighScoreStore::TOP_K) << 56);
+
+HighScoreStore::HighScoreStore()
+    : file(nullptr),
+#ifdef _WIN32
+    fileHandle(nullptr), mappingHandle(nullptr)
+#else
+    fileDescriptor(-1)
+#endif
+{
+}
+
+// Unmaps the file. Everything written is already in the shared mapping, so
+// there is nothing to save here.
+HighScoreStore::~HighScoreStore() {
+    closeFile();
+}
+
+void HighScoreStore::closeFile() {
+#ifdef _WIN32
+    if (file) {
+        UnmapViewOfFile(file);
+    }
+    if (mappingHandle) {
+        CloseHandle(mappingHandle);
+    }
+    if (fileHandle) {
+        CloseHandle(fileHandle);
+    }
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+#else
+    if (file) {
+        munmap(file, sizeof(FileLayout));
+    }
+    if (fileDescriptor >= 0) {
+        ::close(fileDescriptor);
+    }
+    fileDescriptor = -1;
+#endif
+    file = nullptr;
+}
+
+// The file is only ever grown when it is brand new (size 0): anything else must already
+// be exactly the right size and carry the right header, or it is left alone.
+bool HighScoreStore::open(const std::string& path) {
+    closeFile();
+    void* mapped = nullptr;
+#ifdef _WIN32
+    HANDLE handle = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE,
+        FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle == INVALID_HANDLE_VALUE) {
+        std::cerr << "Error: Could not open high score file: " << path << std::endl;
+        return false;
+    }
+    fileHandle = handle;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(handle, &size) || (size.QuadPart != 0 && size.QuadPart != LONGLONG(sizeof(FileLayout)))) {
+        std::cerr << "Error: " << path << " is not a high score file." << std::endl;
+        closeFile();
+        return false;
+    }
+    // Creating the mapping with the full size extends a new (empty) file with zeros.
+    mappingHandle = CreateFileMappingA(handle, nullptr, PAGE_READWRITE, 0, sizeof(FileLayout), nullptr);
+    if (mappingHandle) {
+        mapped = MapViewOfFile(mappingHandle, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(FileLayout));
+    }
+#else
+    fileDescriptor = ::open(path.c_str(), O_RDWR | O_CREAT, 0666);
+    if (fileDescriptor < 0) {
+        std::cerr << "Error: Could not open high score file: " << path << std::endl;
+        return false;
+    }
+    struct stat info;
+    if (fstat(fileDescriptor, &info) != 0 || (info.st_size != 0 && info.st_size != off_t(sizeof(FileLayout)))) {
+        std::cerr << "Error: " << path << " is not a high score file." << std::endl;
+        closeFile();
+        return false;
+    }
+    // A new file is extended with zeros, which is a valid empty leaderboard. Several
+    // processes may do this at once; they all set the same size, so that is harmless.
+    if (info.st_size == 0 && ftruncate(fileDescriptor, sizeof(FileLayout)) != 0) {
+        std::cerr << "Error: Could not size high score file: " << path << std::endl;
+        closeFile();
+        return false;
+    }
+    mapped = mmap(nullptr, sizeof(FileLayout), PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+    if (mapped == MAP_FAILED) {
+        mapped = nullptr;
+    }
+#endif
+    if (!mapped) {
+        std::cerr << "Error: Could not map high score file: " << path << std::endl;
+        closeFile();
+        return false;
+    }
+    file = static_cast<FileLayout*>(mapped);
+
+    // First process to see a zero-filled file claims it; everyone else just checks it.
+    std::uint64_t expected = 0;
+    if (!file->header.compare_exchange_strong(expected, FILE_HEADER) && expected != FILE_HEADER) {
+        std::cerr << "Error: " << path << " is not a compatible high score file." << std::endl;
+        closeFile();
+        return false;
+    }
+    return true;
+}
+
+bool HighScoreStore::isOpen() const {
+    return file != nullptr;
+}
+
+HighScoreStore::LevelBoard* HighScoreStore::board(int level) const {
+    if (!file || level < 1 || level > MAX_LEVELS) {
+        return nullptr;
+    }
+    return &file->boards[level - 1];
+}
+
+std::uint64_t HighScoreStore::pack(int score, int moves) {
+    // +1 keeps every real result above 0, which marks an empty slot.
+    std::uint32_t scorePart = std::uint32_t(score < 0 ? 0 : score) + 1;
+    std::uint32_t movesPart = 0xFFFFFFFFu - std::uint32_t(moves < 0 ? 0 : moves);
+    return (std::uint64_t(scorePart) << 32) | movesPart;
+}
+
+HighScore HighScoreStore::unpack(std::uint64_t packed) {
+    HighScore entry;
+    entry.score = int((packed >> 32) - 1);
+    entry.moves = int(0xFFFFFFFFu - std::uint32_t(packed));
+    return entry;
+}
+
+// Lock-free insert: replace the worst entry if the new result beats it.
+// Entries only ever get replaced by better ones, so the worst entry seen during the scan
+// is still the worst one if the compare-and-swap succeeds. If it fails, another process
+// changed that slot first: count the contention and scan again.
+bool HighScoreStore::submit(int level, int score, int moves) {
+    LevelBoard* levelBoard = board(level);
+    if (!levelBoard) {
+        return false;
+    }
+    levelBoard->submissions.fetch_add(1, std::memory_order_relaxed);
+
+    std::uint64_t candidate = pack(score, moves);
+    while (true) {
+        int worst = 0;
+        std::uint64_t worstValue = levelBoard->entries[0].load(std::memory_order_acquire);
+        for (int i = 1; i < TOP_K; ++i) {
+            std::uint64_t value = levelBoard->entries[i].load(std::memory_order_acquire);
+            if (value < worstValue) {
+                worst = i;
+                worstValue = value;
+            }
+        }
+
+        if (candidate <= worstValue) {
+            return false; // Not good enough for this leaderboard.
+        }
+        if (levelBoard->entries[worst].compare_exchange_weak(worstValue, candidate,
+                std::memory_order_acq_rel, std::memory_order_acquire)) {
+            levelBoard->updates.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+        levelBoard->casRetries.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+// Wait-free read: a fixed number of atomic loads, then a local sort.
+std::vector<HighScore> HighScoreStore::top(int level, int count) const {
+    std::vector<HighScore> result;
+    LevelBoard* levelBoard = board(level);
+    if (!levelBoard) {
+        return result;
+    }
+
+    std::uint64_t values[TOP_K];
+    for (int i = 0; i < TOP_K; ++i) {
+        values[i] = levelBoard->entries[i].load(std::memory_order_acquire);
+    }
+    std::sort(values, values + TOP_K, [](std::uint64_t a, std::uint64_t b) { return a > b; });
+
+    for (int i = 0; i < TOP_K && int(result.size()) < count && values[i] != 0; ++i) {
+        result.push_back(unpack(values[i]));
+    }
+    return result;
+}
+
+HighScoreStore::Stats HighScoreStore::getStats(int level) const {
+    Stats stats = { 0, 0, 0 };
+    LevelBoard* levelBoard = board(level);
+    if (levelBoard) {
+        stats.submissions = levelBoard->submissions.load(std::memory_order_relaxed);
+        stats.updates = levelBoard->updates.load(std::memory_order_relaxed);
+        stats.casRetries = levelBoard->casRetries.load(std::memory_order_relaxed);
+    }
+    return stats;
+}
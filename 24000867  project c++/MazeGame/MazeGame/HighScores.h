@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>   // Scores are updated in place with compare-and-swap.
+#include <cstdint>  // For fixed-size integers in the file layout.
+#include <string>   // For the file path.
+#include <vector>   // For query results.
+
+// One leaderboard entry.
+struct HighScore {
+    int score;
+    int moves;
+};
+
+// A persistent leaderboard per level, shared by every game process on the machine.
+//
+// Why memory-mapped: every process maps the same fixed-size file, so a new score is
+// visible to all of them immediately, without a server, a global lock, or rewriting
+// the file. Each level keeps its best TOP_K entries in TOP_K 64-bit words, updated
+// with atomic compare-and-swap; reading a leaderboard is just TOP_K atomic loads
+// (wait-free), so readers never wait for writers.
+class HighScoreStore {
+public:
+    static const int MAX_LEVELS = 64; // Levels 1..MAX_LEVELS have a leaderboard.
+    static const int TOP_K = 10;      // Entries kept per level.
+
+    // Per-level counters, summed over all processes.
+    struct Stats {
+        std::uint64_t submissions; // submit() calls.
+        std::uint64_t updates;     // Submissions that made it onto the leaderboard.
+        std::uint64_t casRetries;  // Compare-and-swap attempts lost to another process (contention).
+    };
+
+private:
+    // --- File Layout (fixed; the same in every process) ---
+    // Each level's board sits on its own cache lines so updates to different levels
+    // never contend.
+    struct alignas(64) LevelBoard {
+        std::atomic<std::uint64_t> entries[TOP_K]; // Packed scores, 0 = empty. Unsorted.
+        // Counters get their own cache line: every submit() bumps one, and that must not
+        // slow down readers scanning 'entries'.
+        alignas(64) std::atomic<std::uint64_t> submissions;
+        std::atomic<std::uint64_t> updates;
+        std::atomic<std::uint64_t> casRetries;
+    };
+
+    struct alignas(64) FileLayout {
+        // Magic number, layout version, MAX_LEVELS and TOP_K packed in one word (0 = new,
+        // zero-filled file). One word so a single compare-and-swap claims a new file and
+        // publishes its whole header; open() rejects files whose header does not match.
+        std::atomic<std::uint64_t> header;
+        LevelBoard boards[MAX_LEVELS];
+    };
+
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+                  "Shared-memory atomics must be lock-free to work across processes");
+
+    FileLayout* file;  // The mapped file (nullptr if not open).
+#ifdef _WIN32
+    void* fileHandle;     // HANDLE of the file.
+    void* mappingHandle;  // HANDLE of the file mapping.
+#else
+    int fileDescriptor;
+#endif
+
+    LevelBoard* board(int level) const; // nullptr for levels outside 1..MAX_LEVELS.
+    void closeFile();                   // Unmaps and closes everything; safe to call twice.
+
+    // Packs a result so that a larger number is a better result:
+    // higher score first, then fewer moves.
+    static std::uint64_t pack(int score, int moves);
+    static HighScore unpack(std::uint64_t packed);
+
+public:
+    HighScoreStore();
+    ~HighScoreStore();
+
+    // Not copyable: owns the mapping.
+    HighScoreStore(const HighScoreStore&) = delete;
+    HighScoreStore& operator=(const HighScoreStore&) = delete;
+
+    // Opens (creating if needed) the shared leaderboard file. Returns false, leaving the
+    // store closed and the file untouched, if 'path' is not a compatible high score file.
+    bool open(const std::string& path);
+    bool isOpen() const;
+
+    // Records a result. Lock-free: returns true if it made the level's top TOP_K.
+    bool submit(int level, int score, int moves);
+
+    // Best results for 'level', best first. Wait-free.
+    std::vector<HighScore> top(int level, int count = TOP_K) const;
+
+    Stats getStats(int level) const;
+};
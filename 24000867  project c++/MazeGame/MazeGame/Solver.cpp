@@ -0,0 +1,370 @@
+#include "Solver.h"
+#include "Player.h"   // Moves are generated with Player::move() so the solver follows the game's rules.
+#include <thread>     // For parallel BFS and heuristic search.
+#include <atomic>     // For handing out work to threads.
+#include <functional> // For std::function (parallelFor body).
+#include <algorithm>  // For std::reverse, std::min.
+#include <climits>    // For INT_MAX.
+
+// Move letters in the order the BFS tries them (same keys as the keyboard controls).
+static const char MOVES[4] = { 'W', 'A', 'S', 'D' };
+
+// Longest row: cells are indexed y * width + x, and rows may differ in length.
+static int mazeWidth(const std::vector<std::string>& maze) {
+    size_t width = 0;
+    for (const auto& row : maze) {
+        width = std::max(width, row.size());
+    }
+    return int(width);
+}
+
+// True if 'p' is a cell of the maze that can be stood on (not a wall, not outside).
+static bool isOpenCell(const std::vector<std::string>& maze, const Position& p) {
+    return p.y >= 0 && p.y < int(maze.size()) && p.x >= 0 && p.x < int(maze[p.y].size()) &&
+        maze[p.y][p.x] != '#';
+}
+
+// Runs body(0) .. body(count - 1) on up to 'threads' threads.
+static void parallelFor(int count, int threads, const std::function<void(int)>& body) {
+    threads = std::min(threads, count);
+    if (threads <= 1) {
+        for (int i = 0; i < count; ++i) {
+            body(i);
+        }
+        return;
+    }
+    std::atomic<int> next(0);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&]() {
+            for (int i = next++; i < count; i = next++) {
+                body(i);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+// Breadth-first search from 'from' using Player::move() to generate moves.
+// Fills 'distance' (-1 = unreachable) and, if given, the move used to enter each cell.
+// If 'target' is given, stops as soon as that cell has been reached.
+static void bfs(const std::vector<std::string>& maze, const Position& from,
+                std::vector<int>& distance, std::vector<char>* enteredBy,
+                const Position* target = nullptr) {
+    int width = mazeWidth(maze);
+    distance.assign(maze.size() * width, -1);
+    if (enteredBy) {
+        enteredBy->assign(maze.size() * width, 0);
+    }
+
+    std::vector<Position> queue;
+    queue.reserve(maze.size() * width);
+    queue.push_back(from);
+    distance[from.y * width + from.x] = 0;
+
+    Player probe; // A scratch player: we only use its move() rules, never its score.
+    for (size_t head = 0; head < queue.size(); ++head) {
+        Position current = queue[head];
+        int currentDistance = distance[current.y * width + current.x];
+        for (char move : MOVES) {
+            probe.setPosition(current);
+            if (!probe.move(move, maze)) {
+                continue; // Wall or border.
+            }
+            Position next = probe.getPosition();
+            int cell = next.y * width + next.x;
+            if (distance[cell] < 0) {
+                distance[cell] = currentDistance + 1;
+                if (enteredBy) {
+                    (*enteredBy)[cell] = move;
+                }
+                if (target && next == *target) {
+                    return;
+                }
+                queue.push_back(next);
+            }
+        }
+    }
+}
+
+// Shortest move string from 'from' to 'to' (assumes 'to' is reachable).
+static std::string shortestPath(const std::vector<std::string>& maze, const Position& from, const Position& to) {
+    std::vector<int> distance;
+    std::vector<char> enteredBy;
+    bfs(maze, from, distance, &enteredBy, &to); // Legs are usually short: stop at the target.
+
+    int width = mazeWidth(maze);
+    std::string path;
+    Position current = to;
+    while (current != from) {
+        char move = enteredBy[current.y * width + current.x];
+        path += move;
+        // Step back against the move that entered this cell.
+        switch (move) {
+        case 'W': current.y++; break;
+        case 'S': current.y--; break;
+        case 'A': current.x++; break;
+        case 'D': current.x--; break;
+        }
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+// Length of a route: start (0), the collectibles in 'order', then the exit (last point).
+static long long routeLength(const std::vector<std::vector<int>>& d, const std::vector<int>& route) {
+    long long total = 0;
+    for (size_t i = 0; i + 1 < route.size(); ++i) {
+        total += d[route[i]][route[i + 1]];
+    }
+    return total;
+}
+
+// --- Exact: bitmask dynamic programming (Held-Karp) ---
+// best[mask][i] = shortest walk from the start that collects exactly 'mask' and ends on collectible i.
+static std::vector<int> solveExact(const std::vector<std::vector<int>>& d, int collectibles) {
+    int k = collectibles;
+    int exitPoint = k + 1;
+    if (k == 0) {
+        return { 0, exitPoint };
+    }
+
+    int full = (1 << k) - 1;
+    std::vector<int> best((size_t(1) << k) * k, INT_MAX);
+    std::vector<signed char> previous((size_t(1) << k) * k, -1);
+    for (int i = 0; i < k; ++i) {
+        best[(size_t(1) << i) * k + i] = d[0][i + 1];
+    }
+
+    for (int mask = 1; mask <= full; ++mask) {
+        for (int last = 0; last < k; ++last) {
+            int current = best[size_t(mask) * k + last];
+            if (!(mask & (1 << last)) || current == INT_MAX) {
+                continue;
+            }
+            for (int next = 0; next < k; ++next) {
+                if (mask & (1 << next)) {
+                    continue;
+                }
+                int nextMask = mask | (1 << next);
+                int candidate = current + d[last + 1][next + 1];
+                if (candidate < best[size_t(nextMask) * k + next]) {
+                    best[size_t(nextMask) * k + next] = candidate;
+                    previous[size_t(nextMask) * k + next] = char(last);
+                }
+            }
+        }
+    }
+
+    int bestLast = 0;
+    long long bestTotal = LLONG_MAX;
+    for (int last = 0; last < k; ++last) {
+        long long total = (long long)best[size_t(full) * k + last] + d[last + 1][exitPoint];
+        if (total < bestTotal) {
+            bestTotal = total;
+            bestLast = last;
+        }
+    }
+
+    // Walk the 'previous' links back from the best final collectible.
+    std::vector<int> route;
+    route.push_back(exitPoint);
+    int mask = full;
+    for (int last = bestLast; last >= 0; ) {
+        route.push_back(last + 1);
+        int before = previous[size_t(mask) * k + last];
+        mask &= ~(1 << last);
+        last = before;
+    }
+    route.push_back(0);
+    std::reverse(route.begin(), route.end());
+    return route;
+}
+
+// --- Heuristic: local search on one route (start and exit stay fixed) ---
+
+// 2-opt: reverse a stretch of the route if that makes it shorter. Distances are symmetric.
+static bool improveTwoOpt(const std::vector<std::vector<int>>& d, std::vector<int>& route) {
+    bool improved = false;
+    int n = route.size();
+    for (int i = 0; i + 2 < n; ++i) {
+        for (int j = i + 2; j + 1 < n; ++j) {
+            int delta = d[route[i]][route[j]] + d[route[i + 1]][route[j + 1]]
+                - d[route[i]][route[i + 1]] - d[route[j]][route[j + 1]];
+            if (delta < 0) {
+                std::reverse(route.begin() + i + 1, route.begin() + j + 1);
+                improved = true;
+            }
+        }
+    }
+    return improved;
+}
+
+// Or-opt: move a run of 1-3 collectibles to a cheaper place in the route.
+static bool improveOrOpt(const std::vector<std::vector<int>>& d, std::vector<int>& route) {
+    bool improved = false;
+    for (int length = 1; length <= 3; ++length) {
+        for (int i = 1; i + length < int(route.size()); ++i) {
+            int first = route[i];
+            int last = route[i + length - 1];
+            int before = route[i - 1];
+            int after = route[i + length];
+            int removeGain = d[before][first] + d[last][after] - d[before][after];
+
+            for (int j = 0; j + 1 < int(route.size()); ++j) {
+                if (j >= i - 1 && j < i + length) {
+                    continue; // Inserting next to itself changes nothing.
+                }
+                int a = route[j];
+                int b = route[j + 1];
+                int insertCost = d[a][first] + d[last][b] - d[a][b];
+                if (insertCost < removeGain) {
+                    std::vector<int> run(route.begin() + i, route.begin() + i + length);
+                    route.erase(route.begin() + i, route.begin() + i + length);
+                    int insertAt = (j < i) ? j + 1 : j + 1 - length;
+                    route.insert(route.begin() + insertAt, run.begin(), run.end());
+                    improved = true;
+                    break;
+                }
+            }
+        }
+    }
+    return improved;
+}
+
+// Nearest-neighbour route that visits 'firstCollectible' first, then polished by local search.
+static std::vector<int> buildRoute(const std::vector<std::vector<int>>& d, int collectibles, int firstCollectible) {
+    int exitPoint = collectibles + 1;
+    std::vector<bool> visited(collectibles + 2, false);
+    std::vector<int> route = { 0, firstCollectible };
+    visited[0] = visited[firstCollectible] = visited[exitPoint] = true;
+
+    for (int step = 1; step < collectibles; ++step) {
+        int from = route.back();
+        int nearest = -1;
+        for (int p = 1; p <= collectibles; ++p) {
+            if (!visited[p] && (nearest < 0 || d[from][p] < d[from][nearest])) {
+                nearest = p;
+            }
+        }
+        visited[nearest] = true;
+        route.push_back(nearest);
+    }
+    route.push_back(exitPoint);
+
+    while (improveTwoOpt(d, route) || improveOrOpt(d, route)) {
+        // Keep polishing until neither move finds an improvement.
+    }
+    return route;
+}
+
+// Tries several starting collectibles in parallel and keeps the shortest route.
+static std::vector<int> solveHeuristic(const std::vector<std::vector<int>>& d, int collectibles, int threads) {
+    // A few starts per thread: the closest collectibles to the player are the most promising.
+    std::vector<int> starts;
+    for (int p = 1; p <= collectibles; ++p) {
+        starts.push_back(p);
+    }
+    std::sort(starts.begin(), starts.end(), [&](int a, int b) { return d[0][a] < d[0][b]; });
+    starts.resize(std::min<size_t>(starts.size(), size_t(threads) * 2));
+
+    std::vector<std::vector<int>> routes(starts.size());
+    parallelFor(starts.size(), threads, [&](int i) {
+        routes[i] = buildRoute(d, collectibles, starts[i]);
+    });
+
+    size_t best = 0;
+    for (size_t i = 1; i < routes.size(); ++i) {
+        if (routeLength(d, routes[i]) < routeLength(d, routes[best])) {
+            best = i;
+        }
+    }
+    return routes[best];
+}
+
+Solution Solver::solve(const std::vector<std::string>& maze, const Position& start,
+                       const Position& exit, int threads) {
+    Solution solution;
+    if (maze.empty() || maze[0].empty()) {
+        return solution;
+    }
+    if (!isOpenCell(maze, start) || !isOpenCell(maze, exit)) {
+        return solution; // No start or exit (e.g. (-1, -1) for a level without 'E').
+    }
+    if (threads <= 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // Points of interest: 0 = start, 1..k = collectibles, k + 1 = exit.
+    std::vector<Position> points = { start };
+    for (int y = 0; y < int(maze.size()); ++y) {
+        for (int x = 0; x < int(maze[y].size()); ++x) {
+            if (maze[y][x] == '*') {
+                points.push_back(Position(x, y));
+            }
+        }
+    }
+    int collectibles = points.size() - 1;
+    points.push_back(exit);
+
+    // 1. Distance matrix: one BFS per point, in parallel.
+    int width = mazeWidth(maze);
+    std::vector<std::vector<int>> d(points.size(), std::vector<int>(points.size(), -1));
+    parallelFor(points.size(), threads, [&](int i) {
+        std::vector<int> distance;
+        bfs(maze, points[i], distance, nullptr);
+        for (size_t j = 0; j < points.size(); ++j) {
+            d[i][j] = distance[points[j].y * width + points[j].x];
+        }
+    });
+    for (size_t j = 1; j < points.size(); ++j) {
+        if (d[0][j] < 0) {
+            return solution; // Some collectible or the exit cannot be reached.
+        }
+    }
+
+    // 2. Visiting order.
+    std::vector<int> route;
+    if (collectibles <= MAX_EXACT_COLLECTIBLES) {
+        route = solveExact(d, collectibles);
+        solution.optimal = true;
+    }
+    else {
+        route = solveHeuristic(d, collectibles, threads);
+    }
+
+    // 3. Expand every leg into single moves.
+    std::vector<std::string> legs(route.size() - 1);
+    parallelFor(legs.size(), threads, [&](int i) {
+        legs[i] = shortestPath(maze, points[route[i]], points[route[i + 1]]);
+    });
+    for (const auto& leg : legs) {
+        solution.path += leg;
+    }
+    solution.moves = solution.path.size();
+    solution.solved = true;
+    return solution;
+}
+
+bool Solver::verify(const std::vector<std::string>& maze, const Position& start,
+                    const Position& exit, const std::string& path) {
+    std::vector<std::string> remaining = maze; // Collectibles are removed as they are picked up.
+    Player player(start.x, start.y);
+    for (char move : path) {
+        if (!player.move(move, remaining)) {
+            return false; // The route walks into a wall.
+        }
+        Position p = player.getPosition();
+        if (remaining[p.y][p.x] == '*') {
+            remaining[p.y][p.x] = ' ';
+        }
+    }
+    for (const auto& row : remaining) {
+        if (row.find('*') != std::string::npos) {
+            return false;
+        }
+    }
+    return player.getPosition() == exit;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <vector>   // For maze data and distance matrices.
+#include <string>   // For the move string.
+#include "Position.h"
+
+// Result of solving one level.
+struct Solution {
+    bool solved;      // False if the start or exit is not an open cell, or the exit or a collectible cannot be reached.
+    bool optimal;     // True if the route is proven shortest (exact search), false if heuristic.
+    int moves;        // Number of moves in 'path'.
+    std::string path; // Replayable moves, e.g. "DDSSA" (same letters as the keyboard controls).
+
+    Solution() : solved(false), optimal(false), moves(0) {}
+};
+
+// Finds the shortest route from the player's start through every collectible ('*') to the exit.
+// Useful for par scores, bots and checking that a level design is actually completable.
+//
+// How it works:
+//   1. Breadth-first search from the start, every collectible and the exit gives the
+//      exact walking distance between every pair of these points (run in parallel).
+//   2. The visiting order is chosen by bitmask dynamic programming when there are few
+//      collectibles (exact), or by a parallel nearest-neighbour + 2-opt/or-opt search
+//      when there are many (near-optimal).
+//   3. The legs are expanded back into single moves.
+// Movement follows Player::move() exactly (walls and the maze border block, nothing else),
+// and enemies are ignored because their positions change during play.
+class Solver {
+public:
+    // Collectible counts up to this are solved exactly.
+    static const int MAX_EXACT_COLLECTIBLES = 16;
+
+    // Solves 'maze' (as loaded by Game: 'P', 'E' and 'X' already replaced by spaces).
+    // 'threads' = 0 uses all hardware threads.
+    static Solution solve(const std::vector<std::string>& maze, const Position& start,
+                          const Position& exit, int threads = 0);
+
+    // Replays 'path' with Player::move() and checks that it collects every '*' and ends on 'exit'.
+    static bool verify(const std::vector<std::string>& maze, const Position& start,
+                       const Position& exit, const std::string& path);
+};
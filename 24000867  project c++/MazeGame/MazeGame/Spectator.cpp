@@ -0,0 +1,534 @@
+#include "Spectator.h"
+#include "FrameRenderer.h" // For drawing received frames on the viewer side.
+#include <iostream>
+#include <chrono>     // For timing encode/send work.
+#include <cstdio>     // For std::remove (deleting the socket file).
+#include <cstring>    // For std::memset, std::strncpy.
+#include <algorithm>  // For std::remove_if.
+
+// --- Platform Specific Socket Includes & Helpers ---
+// What is already at the socket path (only a socket may be replaced).
+enum PathKind { PATH_MISSING, PATH_SOCKET, PATH_OTHER };
+
+#ifdef _WIN32
+#include <afunix.h> // AF_UNIX support (Windows 10 1803 and later).
+#pragma comment(lib, "ws2_32.lib")
+static const SocketHandle INVALID_HANDLE = INVALID_SOCKET;
+static const int SEND_FLAGS = 0;
+static void closeSocket(SocketHandle s) { closesocket(s); }
+static bool wouldBlock() { return WSAGetLastError() == WSAEWOULDBLOCK; }
+static void setNonBlocking(SocketHandle s) { u_long on = 1; ioctlsocket(s, FIONBIO, &on); }
+static bool initSockets() {
+    WSADATA data;
+    return WSAStartup(MAKEWORD(2, 2), &data) == 0;
+}
+#ifndef IO_REPARSE_TAG_AF_UNIX
+#define IO_REPARSE_TAG_AF_UNIX 0x80000023L // Older SDKs lack this.
+#endif
+// Windows stores a Unix domain socket as a file with an AF_UNIX reparse tag.
+static PathKind getPathKind(const std::string& path) {
+    WIN32_FIND_DATAA info;
+    HANDLE found = FindFirstFileA(path.c_str(), &info);
+    if (found == INVALID_HANDLE_VALUE) {
+        return PATH_MISSING;
+    }
+    FindClose(found);
+    bool isSocket = (info.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) &&
+        info.dwReserved0 == IO_REPARSE_TAG_AF_UNIX;
+    return isSocket ? PATH_SOCKET : PATH_OTHER;
+}
+#else
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/stat.h> // For lstat() (is the path a socket?).
+#include <unistd.h>
+#include <fcntl.h>
+#include <cerrno>
+static const SocketHandle INVALID_HANDLE = -1;
+#ifdef MSG_NOSIGNAL
+static const int SEND_FLAGS = MSG_NOSIGNAL; // A vanished viewer must not kill the game with SIGPIPE.
+#else
+static const int SEND_FLAGS = 0;
+#endif
+static void closeSocket(SocketHandle s) { close(s); }
+static bool wouldBlock() { return errno == EAGAIN || errno == EWOULDBLOCK; }
+static void setNonBlocking(SocketHandle s) { fcntl(s, F_SETFL, fcntl(s, F_GETFL, 0) | O_NONBLOCK); }
+static bool initSockets() { return true; }
+static PathKind getPathKind(const std::string& path) {
+    struct stat info;
+    if (lstat(path.c_str(), &info) != 0) {
+        return errno == ENOENT ? PATH_MISSING : PATH_OTHER;
+    }
+    return S_ISSOCK(info.st_mode) ? PATH_SOCKET : PATH_OTHER;
+}
+#endif
+// --- End Platform Specific Socket Includes & Helpers ---
+
+
+// A viewer with more than this many unsent messages is resynchronised with a keyframe.
+const size_t MAX_BACKLOG_FRAMES = 8;
+// A viewer that accepts no bytes for this many frames in a row is disconnected.
+const int DROP_AFTER_STALLED_FRAMES = 120;
+
+// Message types of the wire format.
+// Every message is: u32 payload length, then the payload:
+//   u8 type, u32 frame number, i32 level, i32 score, i32 moves, then
+//   'K' (keyframe): u16 row count, and for each row u16 length + the row's characters.
+//   'D' (delta):    varint change count, and for each change a varint gap
+//                   (cells skipped since the previous change, rows flattened) + the new character.
+const char MESSAGE_KEYFRAME = 'K';
+const char MESSAGE_DELTA = 'D';
+
+
+// --- Encoding Helpers ---
+static void putU16(std::string& out, std::uint32_t v) {
+    out += char(v & 0xFF);
+    out += char((v >> 8) & 0xFF);
+}
+
+static void putU32(std::string& out, std::uint32_t v) {
+    putU16(out, v & 0xFFFF);
+    putU16(out, v >> 16);
+}
+
+// Variable-length integer: 7 bits per byte, high bit set on all but the last byte.
+static void putVarint(std::string& out, std::uint32_t v) {
+    while (v >= 0x80) {
+        out += char((v & 0x7F) | 0x80);
+        v >>= 7;
+    }
+    out += char(v);
+}
+
+// Writes the common message header and reserves room for the length prefix.
+static void beginMessage(std::string& out, char type, std::uint32_t frameNumber, const Frame& frame) {
+    putU32(out, 0); // Length prefix, patched by endMessage().
+    out += type;
+    putU32(out, frameNumber);
+    putU32(out, std::uint32_t(frame.level));
+    putU32(out, std::uint32_t(frame.score));
+    putU32(out, std::uint32_t(frame.moves));
+}
+
+static void endMessage(std::string& out) {
+    std::uint32_t length = out.size() - 4;
+    for (int i = 0; i < 4; ++i) {
+        out[i] = char((length >> (8 * i)) & 0xFF);
+    }
+}
+
+// True if both grids have the same number of rows and the same row lengths.
+static bool sameShape(const std::vector<std::string>& a, const std::vector<std::string>& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t y = 0; y < a.size(); ++y) {
+        if (a[y].size() != b[y].size()) {
+            return false;
+        }
+    }
+    return true;
+}
+// --- End Encoding Helpers ---
+
+
+// Constructor: spectating stays disabled until start() is called.
+Spectator::Spectator()
+    : listener(INVALID_HANDLE), havePrevious(false), frameNumber(0),
+    framesEncoded(0), bytesEncoded(0), keyframesEncoded(0), viewersDropped(0),
+    viewersResynced(0), viewerFrames(0), totalBytesSent(0),
+    encodeSeconds(0.0), sendSeconds(0.0), peakViewers(0)
+{
+}
+
+// Destructor: closes all connections and removes the socket file.
+// Viewers see the connection close and exit on their own.
+Spectator::~Spectator() {
+    for (auto& viewer : viewers) {
+        closeSocket(viewer.socket);
+    }
+    if (listener != INVALID_HANDLE) {
+        closeSocket(listener);
+        std::remove(socketPath.c_str());
+    }
+}
+
+bool Spectator::start(const std::string& path) {
+    if (!initSockets()) {
+        std::cerr << "Error: Could not initialise sockets for spectators." << std::endl;
+        return false;
+    }
+
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path)) {
+        std::cerr << "Error: Spectator socket path is too long: " << path << std::endl;
+        return false;
+    }
+    std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+
+    // A socket left by a previous run is replaced; anything else (a level file, say)
+    // is never touched.
+    PathKind existing = getPathKind(path);
+    if (existing == PATH_OTHER) {
+        std::cerr << "Error: " << path << " already exists and is not a socket." << std::endl;
+        return false;
+    }
+    if (existing == PATH_SOCKET && std::remove(path.c_str()) != 0) {
+        std::cerr << "Error: Could not remove old spectator socket " << path << std::endl;
+        return false;
+    }
+
+    listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener == INVALID_HANDLE) {
+        std::cerr << "Error: Could not create spectator socket." << std::endl;
+        return false;
+    }
+
+    if (bind(listener, (const sockaddr*)&address, sizeof(address)) != 0 || listen(listener, 64) != 0) {
+        std::cerr << "Error: Could not listen for spectators on " << path << std::endl;
+        closeSocket(listener);
+        listener = INVALID_HANDLE;
+        return false;
+    }
+    setNonBlocking(listener); // accept() must never stall the game loop.
+    socketPath = path;
+    return true;
+}
+
+bool Spectator::isActive() const {
+    return listener != INVALID_HANDLE;
+}
+
+// Accepts every connection waiting on the listener. New viewers start with a keyframe.
+void Spectator::acceptViewers() {
+    while (true) {
+        SocketHandle client = accept(listener, nullptr, nullptr);
+        if (client == INVALID_HANDLE) {
+            return; // No more pending connections (or a transient error).
+        }
+        setNonBlocking(client);
+
+        Viewer viewer;
+        viewer.socket = client;
+        viewer.sentOffset = 0;
+        viewer.needsKeyframe = true;
+        viewer.stalledFrames = 0;
+        viewer.bytesSent = 0;
+        viewers.push_back(viewer);
+    }
+}
+
+// Sends queued messages until the socket would block. The buffers are sent in place;
+// nothing is copied per viewer.
+bool Spectator::flush(Viewer& viewer) {
+    while (!viewer.pending.empty()) {
+        const std::string& message = *viewer.pending.front();
+        const char* data = message.data() + viewer.sentOffset;
+        int remaining = int(message.size() - viewer.sentOffset);
+
+        int sent = int(send(viewer.socket, data, remaining, SEND_FLAGS));
+        if (sent < 0) {
+            return wouldBlock(); // Full socket buffer is fine; anything else is a dead viewer.
+        }
+        viewer.sentOffset += sent;
+        viewer.bytesSent += sent;
+        totalBytesSent += sent;
+        if (viewer.sentOffset == message.size()) {
+            viewer.pending.pop_front();
+            viewer.sentOffset = 0;
+        }
+    }
+    return true;
+}
+
+void Spectator::closeViewer(Viewer& viewer) {
+    closeSocket(viewer.socket);
+    viewer.socket = INVALID_HANDLE;
+    viewersDropped++;
+}
+
+// Full snapshot: row sizes plus every cell.
+Spectator::Buffer Spectator::encodeKeyframe(const Frame& frame) const {
+    std::string out;
+    beginMessage(out, MESSAGE_KEYFRAME, frameNumber, frame);
+    putU16(out, frame.grid.size());
+    for (const auto& row : frame.grid) {
+        putU16(out, row.size());
+        out += row;
+    }
+    endMessage(out);
+    return std::make_shared<const std::string>(std::move(out));
+}
+
+// Only the cells that differ from the previous frame.
+// A typical turn changes a handful of cells, so a delta is usually a few dozen bytes.
+Spectator::Buffer Spectator::encodeDelta(const Frame& frame) const {
+    std::string changes;
+    std::uint32_t changeCount = 0;
+    std::uint32_t cellIndex = 0;      // Flattened index of the current cell.
+    std::uint32_t nextUnchanged = 0;  // Flattened index just after the last change written.
+
+    for (size_t y = 0; y < frame.grid.size(); ++y) {
+        const std::string& row = frame.grid[y];
+        const std::string& oldRow = previous.grid[y];
+        for (size_t x = 0; x < row.size(); ++x, ++cellIndex) {
+            if (row[x] != oldRow[x]) {
+                putVarint(changes, cellIndex - nextUnchanged);
+                changes += row[x];
+                nextUnchanged = cellIndex + 1;
+                changeCount++;
+            }
+        }
+    }
+
+    std::string out;
+    beginMessage(out, MESSAGE_DELTA, frameNumber, frame);
+    putVarint(out, changeCount);
+    out += changes;
+    endMessage(out);
+    return std::make_shared<const std::string>(std::move(out));
+}
+
+// Encodes the frame once and hands the shared buffer to every viewer.
+void Spectator::broadcast(const Frame& frame) {
+    if (!isActive()) {
+        return;
+    }
+    acceptViewers();
+    if (viewers.empty()) {
+        havePrevious = false; // Nobody to stream to; the next viewer starts from a keyframe anyway.
+        return;
+    }
+    frameNumber++;
+
+    // 1. Viewers too far behind skip ahead: drop their backlog and wait for a keyframe.
+    // A partly sent message is kept so the byte stream stays correctly framed.
+    for (auto& viewer : viewers) {
+        if (viewer.pending.size() > MAX_BACKLOG_FRAMES) {
+            Buffer partial = viewer.sentOffset > 0 ? viewer.pending.front() : nullptr;
+            viewer.pending.clear();
+            if (partial) {
+                viewer.pending.push_back(partial);
+            }
+            viewer.needsKeyframe = true;
+            viewersResynced++;
+        }
+    }
+
+    // 2. Encode at most one delta and one keyframe, regardless of the number of viewers.
+    bool shapeChanged = !havePrevious || !sameShape(previous.grid, frame.grid);
+    bool needDelta = false;
+    bool needKeyframe = shapeChanged;
+    for (const auto& viewer : viewers) {
+        if (viewer.needsKeyframe) {
+            needKeyframe = true;
+        }
+        else if (!shapeChanged) {
+            needDelta = true;
+        }
+    }
+
+    auto encodeStart = std::chrono::steady_clock::now();
+    Buffer delta = needDelta ? encodeDelta(frame) : nullptr;
+    Buffer keyframe = needKeyframe ? encodeKeyframe(frame) : nullptr;
+    encodeSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - encodeStart).count();
+
+    framesEncoded++;
+    if (delta) {
+        bytesEncoded += delta->size();
+    }
+    if (keyframe) {
+        bytesEncoded += keyframe->size();
+        keyframesEncoded++;
+    }
+
+    // 3. Queue the shared buffer for each viewer and push out whatever the sockets accept.
+    auto sendStart = std::chrono::steady_clock::now();
+    for (auto& viewer : viewers) {
+        if (shapeChanged || viewer.needsKeyframe) {
+            viewer.pending.push_back(keyframe);
+            viewer.needsKeyframe = false;
+        }
+        else {
+            viewer.pending.push_back(delta);
+        }
+
+        std::uint64_t before = viewer.bytesSent;
+        if (!flush(viewer)) {
+            closeViewer(viewer); // Viewer went away.
+            continue;
+        }
+        viewer.stalledFrames = (viewer.bytesSent == before && !viewer.pending.empty()) ? viewer.stalledFrames + 1 : 0;
+        if (viewer.stalledFrames > DROP_AFTER_STALLED_FRAMES) {
+            closeViewer(viewer); // Viewer stopped reading entirely.
+        }
+    }
+    sendSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - sendStart).count();
+
+    viewerFrames += viewers.size();
+    if (int(viewers.size()) > peakViewers) {
+        peakViewers = viewers.size();
+    }
+    viewers.erase(std::remove_if(viewers.begin(), viewers.end(),
+        [](const Viewer& viewer) { return viewer.socket == INVALID_HANDLE; }), viewers.end());
+
+    previous = frame;
+    havePrevious = true;
+}
+
+// Prints how much the spectators cost: encoding is shared, sending is per viewer.
+void Spectator::printStats(std::ostream& out) const {
+    if (!isActive()) {
+        return;
+    }
+    out << "\n--- Spectator Statistics ---\n";
+    out << "Frames encoded: " << framesEncoded << " (" << keyframesEncoded << " keyframes), "
+        << bytesEncoded << " bytes encoded\n";
+    out << "Peak viewers: " << peakViewers << ", dropped: " << viewersDropped
+        << ", resynced: " << viewersResynced << "\n";
+    if (viewerFrames > 0) {
+        out << "Per viewer per frame: " << double(totalBytesSent) / viewerFrames << " bytes, "
+            << (encodeSeconds / framesEncoded + sendSeconds / viewerFrames) * 1e6 << " us CPU\n";
+        out << "  (encode " << encodeSeconds / framesEncoded * 1e6 << " us/frame is shared by all viewers)\n";
+    }
+}
+
+// --- Viewer Side ---
+
+// Reads exactly 'size' bytes. Returns false if the connection closed.
+static bool receiveAll(SocketHandle s, char* data, size_t size) {
+    while (size > 0) {
+        int received = int(recv(s, data, int(size), 0));
+        if (received <= 0) {
+            return false;
+        }
+        data += received;
+        size -= received;
+    }
+    return true;
+}
+
+// Small reader over one received payload.
+struct MessageReader {
+    const std::string& data;
+    size_t offset;
+    bool ok;
+
+    MessageReader(const std::string& payload) : data(payload), offset(0), ok(true) {}
+
+    std::uint32_t byte() {
+        if (offset >= data.size()) {
+            ok = false;
+            return 0;
+        }
+        return std::uint8_t(data[offset++]);
+    }
+    std::uint32_t u16() { std::uint32_t lo = byte(); return lo | (byte() << 8); }
+    std::uint32_t u32() { std::uint32_t lo = u16(); return lo | (u16() << 16); }
+    std::uint32_t varint() {
+        std::uint32_t value = 0;
+        for (int shift = 0; shift < 35; shift += 7) {
+            std::uint32_t b = byte();
+            value |= (b & 0x7F) << shift;
+            if (!(b & 0x80)) {
+                break;
+            }
+        }
+        return value;
+    }
+};
+
+// Connects to a game and redraws every frame it streams.
+bool Spectator::watch(const std::string& path) {
+    if (!initSockets()) {
+        std::cerr << "Error: Could not initialise sockets." << std::endl;
+        return false;
+    }
+
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+
+    SocketHandle s = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (s == INVALID_HANDLE || connect(s, (const sockaddr*)&address, sizeof(address)) != 0) {
+        std::cerr << "Error: Could not connect to game at " << path << std::endl;
+        if (s != INVALID_HANDLE) {
+            closeSocket(s);
+        }
+        return false;
+    }
+
+    Frame frame;
+    bool haveKeyframe = false;
+    std::string payload;
+    char lengthBytes[4];
+
+    while (receiveAll(s, lengthBytes, 4)) {
+        std::uint32_t length = 0;
+        for (int i = 0; i < 4; ++i) {
+            length |= std::uint32_t(std::uint8_t(lengthBytes[i])) << (8 * i);
+        }
+        payload.resize(length);
+        if (!receiveAll(s, &payload[0], length)) {
+            break;
+        }
+
+        MessageReader reader(payload);
+        char type = char(reader.byte());
+        reader.u32(); // Frame number (not needed for drawing).
+        frame.level = int(reader.u32());
+        frame.score = int(reader.u32());
+        frame.moves = int(reader.u32());
+
+        if (type == MESSAGE_KEYFRAME) {
+            frame.grid.assign(reader.u16(), std::string());
+            for (auto& row : frame.grid) {
+                std::uint32_t rowLength = reader.u16();
+                if (reader.offset + rowLength > payload.size()) {
+                    reader.ok = false;
+                    break;
+                }
+                row.assign(payload, reader.offset, rowLength);
+                reader.offset += rowLength;
+            }
+            haveKeyframe = reader.ok;
+        }
+        else if (type == MESSAGE_DELTA && haveKeyframe) {
+            std::uint32_t changeCount = reader.varint();
+            size_t y = 0;
+            size_t x = 0;
+            for (std::uint32_t i = 0; i < changeCount && reader.ok; ++i) {
+                std::uint32_t gap = reader.varint();
+                char cell = char(reader.byte());
+                // Walk 'gap' cells forward through the flattened grid.
+                x += gap;
+                while (y < frame.grid.size() && x >= frame.grid[y].size()) {
+                    x -= frame.grid[y].size();
+                    y++;
+                }
+                if (y >= frame.grid.size()) {
+                    reader.ok = false;
+                    break;
+                }
+                frame.grid[y][x] = cell;
+                x++; // The next gap counts from the cell after this one.
+            }
+        }
+
+        if (!reader.ok) {
+            std::cerr << "Error: Received a corrupt frame." << std::endl;
+            break;
+        }
+        if (haveKeyframe) {
+            FrameRenderer::displayFrame(frame);
+            std::cout << "(Spectating - the game is played in another window)" << std::endl;
+        }
+    }
+
+    closeSocket(s);
+    std::cout << "\nThe game has ended or the connection was closed.\n";
+    return true;
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <vector>   // For the viewer list and pending buffers.
+#include <deque>    // For each viewer's queue of frames still to send.
+#include <string>   // For socket paths and encoded frame bytes.
+#include <memory>   // For std::shared_ptr (one encoded buffer shared by all viewers).
+#include <cstdint>  // For fixed-size integers in the wire format.
+#include <ostream>  // For printing statistics.
+#include "Frame.h"  // Frames are what gets streamed.
+
+// --- Platform Specific Socket Type ---
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX // Prevent conflicts with Windows headers defining min/max macros.
+#endif
+#include <winsock2.h> // Must come before <windows.h>.
+typedef SOCKET SocketHandle;   // Windows sockets are SOCKET handles.
+#else
+typedef int SocketHandle;      // POSIX sockets are file descriptors.
+#endif
+// --- End Platform Specific Socket Type ---
+
+// Streams game frames to any number of local viewers over a Unix domain socket.
+//
+// Why encode once: every frame is turned into bytes exactly once (a compact delta of
+// changed cells, or a full keyframe), and the same buffer is queued for every viewer
+// through a shared_ptr. Adding a viewer costs one send() per frame, not one render.
+//
+// Slow viewers never stall the game: sockets are non-blocking, a viewer that falls too
+// far behind has its backlog thrown away and is resynchronised with the next keyframe,
+// and a viewer that stops reading altogether is disconnected.
+class Spectator {
+private:
+    typedef std::shared_ptr<const std::string> Buffer; // One encoded message, shared read-only.
+
+    // Per-viewer connection state.
+    struct Viewer {
+        SocketHandle socket;
+        std::deque<Buffer> pending; // Messages queued but not fully sent yet.
+        size_t sentOffset;          // Bytes of pending.front() already sent.
+        bool needsKeyframe;         // True until the viewer has been sent a keyframe.
+        int stalledFrames;          // Consecutive frames in which the viewer accepted no bytes.
+        std::uint64_t bytesSent;    // Total bytes delivered to this viewer.
+    };
+
+    SocketHandle listener;       // Listening socket (invalid when spectating is disabled).
+    std::string socketPath;      // Filesystem path of the Unix domain socket.
+    std::vector<Viewer> viewers; // Currently connected viewers.
+
+    Frame previous;              // Last frame encoded (deltas are computed against it).
+    bool havePrevious;           // False until the first frame has been encoded.
+    std::uint32_t frameNumber;   // Incremented for every broadcast frame.
+
+    // --- Statistics ---
+    std::uint64_t framesEncoded;   // Number of broadcast() calls that encoded something.
+    std::uint64_t bytesEncoded;    // Total size of all encoded messages (delta + keyframe).
+    std::uint64_t keyframesEncoded;
+    std::uint64_t viewersDropped;
+    std::uint64_t viewersResynced; // Times a slow viewer skipped ahead to a keyframe.
+    std::uint64_t viewerFrames;    // Sum over frames of connected viewers (for per-viewer averages).
+    std::uint64_t totalBytesSent;  // Bytes delivered to all viewers, including dropped ones.
+    double encodeSeconds;          // Time spent encoding (independent of viewer count).
+    double sendSeconds;            // Time spent handing buffers to the kernel (per viewer).
+    int peakViewers;
+
+    // --- Helpers ---
+    void acceptViewers();                 // Accepts any pending connections (non-blocking).
+    bool flush(Viewer& viewer);           // Sends as much queued data as the socket takes. False on error.
+    void closeViewer(Viewer& viewer);     // Closes the connection and counts the drop.
+    Buffer encodeKeyframe(const Frame& frame) const;
+    Buffer encodeDelta(const Frame& frame) const; // Requires havePrevious and equal grid sizes.
+
+public:
+    Spectator();
+    ~Spectator();
+
+    // Not copyable: owns sockets.
+    Spectator(const Spectator&) = delete;
+    Spectator& operator=(const Spectator&) = delete;
+
+    // Starts listening on 'path'. Returns false (and prints why) on failure.
+    bool start(const std::string& path);
+
+    // True once start() has succeeded.
+    bool isActive() const;
+
+    // Encodes 'frame' once and queues it for every connected viewer.
+    // Never blocks; does nothing if spectating is not active.
+    void broadcast(const Frame& frame);
+
+    // Prints bytes and CPU time per viewer.
+    void printStats(std::ostream& out) const;
+
+    // --- Viewer Side ---
+    // Connects to a running game at 'path' and draws every received frame until the
+    // game ends or the connection drops. Returns false if the connection failed.
+    static bool watch(const std::string& path);
+};
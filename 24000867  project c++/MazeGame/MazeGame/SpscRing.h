@@ -0,0 +1,51 @@
+#pragma once
+
+#include <atomic>  // For the lock-free head/tail indices.
+#include <cstddef> // For size_t.
+
+// A fixed-size, lock-free queue for exactly one producer thread and one consumer thread.
+// Used to hand key presses from the input thread to the simulation thread.
+// Why lock-free: neither side ever waits on a mutex held by the other, so a thread
+// that is slow (or blocked reading the keyboard) can never hold up the other one.
+// 'Capacity' must be a power of two so indices can wrap with a cheap bit mask.
+template <typename T, size_t Capacity>
+class SpscRing {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+private:
+    T items[Capacity];
+    // Head and tail live on separate cache lines so the two threads do not fight over one line.
+    alignas(64) std::atomic<size_t> head; // Next slot to read. Written only by the consumer.
+    alignas(64) std::atomic<size_t> tail; // Next slot to write. Written only by the producer.
+
+public:
+    SpscRing() : head(0), tail(0) {}
+
+    // Producer side. Returns false if the ring is full.
+    bool push(const T& item) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t - head.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+        items[t & (Capacity - 1)] = item;
+        tail.store(t + 1, std::memory_order_release); // Publishes the item to the consumer.
+        return true;
+    }
+
+    // True if nothing is waiting. Either side may ask; the answer may be stale by the
+    // time it is used, which is fine for "only push when the consumer has caught up".
+    bool empty() const {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+
+    // Consumer side. Returns false if the ring is empty.
+    bool pop(T& item) {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = items[h & (Capacity - 1)];
+        head.store(h + 1, std::memory_order_release); // Hands the slot back to the producer.
+        return true;
+    }
+};
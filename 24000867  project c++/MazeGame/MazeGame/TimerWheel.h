@@ -0,0 +1,100 @@
+#pragma once
+
+#include <vector>  // For the slot lists.
+#include <cstdint> // For std::uint64_t tick counts.
+#include <cstddef> // For size_t.
+
+// A hierarchical timer wheel: schedules values to come due a number of ticks from now.
+// Used by the enemy scheduler to wake sleeping enemies.
+//
+// How it works: level 0 has one slot per tick for the current 64-tick block, level 1
+// one slot per 64-tick block of the current 4096-tick block, and level 2 one slot per
+// 4096-tick block. When a block starts, the matching higher-level slot is "cascaded"
+// down. Scheduling is O(1) and advancing costs O(1) plus the entries that come due,
+// no matter how many timers are pending.
+template <typename T>
+class TimerWheel {
+private:
+    static const int SLOT_BITS = 6;               // 64 slots per level.
+    static const int SLOTS = 1 << SLOT_BITS;
+    static const int LEVELS = 3;                  // Covers 64^3 = 262144 ticks.
+
+    struct Entry {
+        std::uint64_t due; // Absolute tick at which the value comes due.
+        T value;
+    };
+
+    std::vector<Entry> slots[LEVELS][SLOTS];
+    std::vector<Entry> overflow; // Entries beyond level 2's range (re-checked every 262144 ticks).
+    std::uint64_t now;           // Current tick.
+    size_t pending;              // Number of scheduled entries.
+
+    // Puts an entry into the lowest level whose current block contains its due tick.
+    void insert(const Entry& entry) {
+        for (int level = 0; level < LEVELS; ++level) {
+            int blockShift = SLOT_BITS * (level + 1);
+            if ((entry.due >> blockShift) == (now >> blockShift)) {
+                slots[level][(entry.due >> (SLOT_BITS * level)) & (SLOTS - 1)].push_back(entry);
+                return;
+            }
+        }
+        overflow.push_back(entry);
+    }
+
+    // Re-inserts every entry of a higher-level slot (they now belong to a lower level).
+    void cascade(std::vector<Entry>& slot) {
+        std::vector<Entry> moving;
+        moving.swap(slot);
+        for (const auto& entry : moving) {
+            insert(entry);
+        }
+    }
+
+public:
+    TimerWheel() : now(0), pending(0) {}
+
+    // Schedules 'value' to come due 'delay' ticks from now (at least 1).
+    void schedule(const T& value, std::uint64_t delay) {
+        if (delay == 0) {
+            delay = 1;
+        }
+        insert(Entry{ now + delay, value });
+        pending++;
+    }
+
+    // Moves to the next tick and appends every value that comes due to 'due'.
+    void advance(std::vector<T>& due) {
+        now++;
+        if ((now & (SLOTS - 1)) == 0) {
+            // Start of a new 64-tick block: pull its entries down from the higher levels.
+            if (((now >> SLOT_BITS) & (SLOTS - 1)) == 0) {
+                if (((now >> (2 * SLOT_BITS)) & (SLOTS - 1)) == 0) {
+                    cascade(overflow);
+                }
+                cascade(slots[2][(now >> (2 * SLOT_BITS)) & (SLOTS - 1)]);
+            }
+            cascade(slots[1][(now >> SLOT_BITS) & (SLOTS - 1)]);
+        }
+
+        std::vector<Entry>& slot = slots[0][now & (SLOTS - 1)];
+        for (const auto& entry : slot) {
+            due.push_back(entry.value);
+        }
+        pending -= slot.size();
+        slot.clear();
+    }
+
+    // Removes every scheduled entry (e.g. when a new level starts).
+    void clear() {
+        for (auto& level : slots) {
+            for (auto& slot : level) {
+                slot.clear();
+            }
+        }
+        overflow.clear();
+        pending = 0;
+    }
+
+    std::uint64_t currentTick() const { return now; }
+    size_t size() const { return pending; }
+};
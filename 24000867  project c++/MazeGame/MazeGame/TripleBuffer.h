@@ -0,0 +1,52 @@
+#pragma once
+
+#include <atomic> // For the lock-free slot exchange.
+
+// Hands the newest value from one writer thread to one reader thread without locks.
+// Used to pass finished frames from the simulation thread to the render thread.
+//
+// How it works: there are three slots. The writer owns one ("back"), the reader owns
+// one ("front"), and the third ("middle") is swapped atomically between them.
+// The writer fills its slot and swaps it into the middle; the reader swaps the middle
+// out when a fresh value is waiting. Neither side ever waits: if the reader is slow,
+// older values are simply overwritten and the reader always gets the newest one.
+template <typename T>
+class TripleBuffer {
+private:
+    static const int INDEX_MASK = 3; // Low bits of 'middle' hold the slot index.
+    static const int FRESH = 4;      // Set when the middle slot holds an unread value.
+
+    T slots[3];
+    std::atomic<int> middle; // Shared slot index (+ FRESH flag).
+    int back;                // Writer's slot. Touched only by the writer thread.
+    int front;               // Reader's slot. Touched only by the reader thread.
+
+public:
+    TripleBuffer() : middle(1), back(0), front(2) {}
+
+    // --- Writer Side ---
+    // The slot to fill before calling publish().
+    T& writeSlot() {
+        return slots[back];
+    }
+
+    // Makes the filled slot available to the reader and takes a free slot for the next write.
+    void publish() {
+        back = middle.exchange(back | FRESH, std::memory_order_acq_rel) & INDEX_MASK;
+    }
+
+    // --- Reader Side ---
+    // Swaps in the newest published value. Returns false if nothing new was published.
+    bool update() {
+        if (!(middle.load(std::memory_order_relaxed) & FRESH)) {
+            return false;
+        }
+        front = middle.exchange(front, std::memory_order_acq_rel) & INDEX_MASK;
+        return true;
+    }
+
+    // The value obtained by the last successful update(). Not modified by the writer.
+    const T& readSlot() const {
+        return slots[front];
+    }
+};
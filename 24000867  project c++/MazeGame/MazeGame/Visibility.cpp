@@ -0,0 +1,156 @@
+#include "Visibility.h"
+#include <algorithm> // For std::fill, std::max, std::min.
+
+// Octant multipliers for shadowcasting.
+// Each column maps the octant-local (dx, dy) scan onto one of the 8 octants around the viewer.
+static const int OCTANT_XX[8] = { 1, 0, 0, -1, -1, 0, 0, 1 };
+static const int OCTANT_XY[8] = { 0, 1, -1, 0, 0, -1, 1, 0 };
+static const int OCTANT_YX[8] = { 0, 1, 1, 0, 0, -1, -1, 0 };
+static const int OCTANT_YY[8] = { 1, 0, 0, 1, -1, 0, 0, -1 };
+
+// Constructor implementation.
+// Starts with an empty (0x0) map; build() sizes everything once a level is loaded.
+Visibility::Visibility(int viewRadius)
+    : width(0), height(0), wordsPerRow(0), radius(viewRadius),
+    origin(-1, -1), minRow(0), maxRow(-1)
+{
+}
+
+// Packs '#' cells into the wall bitboard and resets visible/explored bits.
+void Visibility::build(const std::vector<std::string>& maze) {
+    height = maze.size();
+    width = maze.empty() ? 0 : maze[0].size();
+    wordsPerRow = (width + 63) / 64;
+
+    walls.assign(height * wordsPerRow, 0);
+    visible.assign(height * wordsPerRow, 0);
+    explored.assign(height * wordsPerRow, 0);
+
+    for (int y = 0; y < height; ++y) {
+        // Rows may be shorter than the first one; missing cells count as open space.
+        int rowWidth = std::min<int>(maze[y].size(), width);
+        for (int x = 0; x < rowWidth; ++x) {
+            if (maze[y][x] == '#') {
+                walls[y * wordsPerRow + x / 64] |= (std::uint64_t(1) << (x % 64));
+            }
+        }
+    }
+
+    origin = Position(-1, -1); // Force the next update() to compute a fresh view.
+    minRow = 0;
+    maxRow = -1;
+}
+
+// Reads one bit from a packed bitboard. Out of range cells read as 0.
+bool Visibility::testBit(const std::vector<std::uint64_t>& bits, int x, int y) const {
+    if (x < 0 || x >= width || y < 0 || y >= height) {
+        return false;
+    }
+    return (bits[y * wordsPerRow + x / 64] >> (x % 64)) & 1;
+}
+
+// Marks a cell as visible now and as explored for the rest of the level.
+void Visibility::setVisible(int x, int y) {
+    if (x < 0 || x >= width || y < 0 || y >= height) {
+        return;
+    }
+    std::uint64_t mask = std::uint64_t(1) << (x % 64);
+    visible[y * wordsPerRow + x / 64] |= mask;
+    explored[y * wordsPerRow + x / 64] |= mask;
+}
+
+bool Visibility::blocksSight(int x, int y) const {
+    if (x < 0 || x >= width || y < 0 || y >= height) {
+        return true;
+    }
+    return testBit(walls, x, y);
+}
+
+// Recomputes the field of view around 'viewer'.
+void Visibility::update(const Position& viewer) {
+    if (viewer == origin || width == 0) {
+        return; // Nothing moved, the current view is still valid.
+    }
+
+    // Clear only the rows the previous view could have lit.
+    for (int y = minRow; y <= maxRow; ++y) {
+        std::fill(visible.begin() + y * wordsPerRow, visible.begin() + (y + 1) * wordsPerRow, 0);
+    }
+
+    origin = viewer;
+    minRow = std::max(0, viewer.y - radius);
+    maxRow = std::min(height - 1, viewer.y + radius);
+
+    setVisible(viewer.x, viewer.y); // The viewer always sees their own cell.
+    for (int octant = 0; octant < 8; ++octant) {
+        castLight(1, 1.0, 0.0,
+                  OCTANT_XX[octant], OCTANT_XY[octant], OCTANT_YX[octant], OCTANT_YY[octant]);
+    }
+}
+
+// Recursive shadowcasting (one octant).
+// Scans rows moving away from the viewer. When a wall starts a shadow, the lit part
+// beyond it is handled by a recursive call and the scan continues past the shadow.
+void Visibility::castLight(int row, double startSlope, double endSlope,
+                           int xx, int xy, int yx, int yy) {
+    if (startSlope < endSlope) {
+        return;
+    }
+    const int radiusSquared = radius * radius;
+    double newStart = 0.0;
+
+    for (int j = row; j <= radius; ++j) {
+        int dx = -j - 1;
+        int dy = -j;
+        bool blocked = false;
+
+        while (dx <= 0) {
+            dx++;
+            int mapX = origin.x + dx * xx + dy * xy;
+            int mapY = origin.y + dx * yx + dy * yy;
+            double leftSlope = (dx - 0.5) / (dy + 0.5);
+            double rightSlope = (dx + 0.5) / (dy - 0.5);
+
+            if (startSlope < rightSlope) {
+                continue; // Cell is left of the lit area.
+            }
+            if (endSlope > leftSlope) {
+                break;    // Cell (and the rest of this row) is right of the lit area.
+            }
+
+            if (dx * dx + dy * dy <= radiusSquared) {
+                setVisible(mapX, mapY);
+            }
+
+            bool wall = blocksSight(mapX, mapY);
+            if (blocked) {
+                if (wall) {
+                    newStart = rightSlope; // Still inside a shadow.
+                    continue;
+                }
+                blocked = false;           // Shadow ended, continue with the narrowed light.
+                startSlope = newStart;
+            }
+            else if (wall && j < radius) {
+                blocked = true;            // A wall starts a shadow; light beyond it recursively.
+                castLight(j + 1, startSlope, leftSlope, xx, xy, yx, yy);
+                newStart = rightSlope;
+            }
+        }
+        if (blocked) {
+            break; // The row ended in shadow, nothing further can be lit.
+        }
+    }
+}
+
+bool Visibility::isVisible(int x, int y) const {
+    return testBit(visible, x, y);
+}
+
+bool Visibility::isVisible(const Position& p) const {
+    return testBit(visible, p.x, p.y);
+}
+
+bool Visibility::isExplored(int x, int y) const {
+    return testBit(explored, x, y);
+}
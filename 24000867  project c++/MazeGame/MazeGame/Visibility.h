@@ -0,0 +1,58 @@
+#pragma once
+
+#include <vector>   // For the packed bit rows.
+#include <string>   // For maze data type (std::vector<std::string>).
+#include <cstdint>  // For std::uint64_t bit words.
+#include "Position.h" // Field of view is computed around a Position.
+
+// Computes what the player can see from their current cell.
+// Why bit-packed: walls, currently visible cells and explored cells are each stored
+// as one bit per cell (64 cells per word) instead of scanning std::string rows.
+// An "is this cell visible?" question (e.g. "can this enemy see the player?") is then
+// a single bit test, no matter how many enemies ask it.
+class Visibility {
+private:
+    int width;        // Maze width in cells.
+    int height;       // Maze height in cells.
+    int wordsPerRow;  // Number of 64-bit words needed to hold one maze row.
+    int radius;       // How far the player can see (in cells).
+
+    std::vector<std::uint64_t> walls;    // 1 = wall ('#'). Built once per level.
+    std::vector<std::uint64_t> visible;  // 1 = in the player's current field of view.
+    std::vector<std::uint64_t> explored; // 1 = seen at least once this level (fog of war memory).
+
+    Position origin;  // Cell the current field of view was computed from.
+    int minRow;       // First row touched by the current field of view (for cheap clearing).
+    int maxRow;       // Last row touched by the current field of view.
+
+    // --- Bit Helpers ---
+    bool testBit(const std::vector<std::uint64_t>& bits, int x, int y) const;
+    void setVisible(int x, int y);
+
+    // Returns true for walls and for anything outside the maze (outside blocks sight).
+    bool blocksSight(int x, int y) const;
+
+    // Recursive shadowcasting over one octant.
+    // 'startSlope'/'endSlope' bound the still-lit part of the octant, and the
+    // xx/xy/yx/yy multipliers map octant-local coordinates onto maze coordinates.
+    void castLight(int row, double startSlope, double endSlope,
+                   int xx, int xy, int yx, int yy);
+
+public:
+    // Constructor. 'viewRadius' is the sight distance in cells.
+    Visibility(int viewRadius = 8);
+
+    // Packs the walls of a freshly loaded maze and forgets all previous visibility.
+    // Call once per level; walls never change during play.
+    void build(const std::vector<std::string>& maze);
+
+    // Recomputes the field of view from 'viewer'.
+    // Incremental: does nothing if the viewer has not moved, and only clears the rows
+    // the previous field of view touched, so the cost depends on the radius, not the maze size.
+    void update(const Position& viewer);
+
+    // --- Queries (single bit tests) ---
+    bool isVisible(int x, int y) const;
+    bool isVisible(const Position& p) const;
+    bool isExplored(int x, int y) const;
+};
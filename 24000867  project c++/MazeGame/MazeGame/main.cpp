@@ -1,5 +1,9 @@
 #include "Game.h"   // Include the Game class definition.
 #include <iostream> // Standard Input/Output streams.
+#include <string>   // For command line arguments.
+#include <cstdio>   // For std::sscanf (--scores-worker).
+#include "Spectator.h" // For watching another game (--watch).
+#include "Benchmarks.h" // For the --bench-* and --scores-stress options.
 
 // --- Windows Specific Setup for ANSI Colors ---
 // Necessary for ANSI escape codes (like colors) to work in standard
@@ -33,7 +37,23 @@ void EnableVirtualTerminalProcessing() {
 // --- End of Windows Specific Setup ---
 
 
-int main() {
+// Command line:
+//   MazeGame                      Play normally.
+//   MazeGame --spectate <socket>  Play and let other terminals watch through <socket>.
+//   MazeGame --watch <socket>     Watch a game started with --spectate.
+//   MazeGame --slow-render <ms>   Delay every frame before drawing it (slow terminal) and
+//                                 print simulation/render timings at the end.
+//   MazeGame --scripted-input <n> Play with a fixed-rate key script instead of the keyboard
+//                                 for <n> ticks, then print the timings (unattended runs).
+//   MazeGame --solve              Print the par moves and a shortest route for every level.
+//   MazeGame --scores             Print the shared high score tables.
+//   MazeGame --bench-fov          Time field of view updates and visibility queries.
+//   MazeGame --bench-enemies      Time enemy scheduling with 1k, 10k and 100k enemies.
+//   MazeGame --bench-solver       Time the solver on large generated mazes.
+//   MazeGame --scores-stress <n>  Stress the shared high score file with <n> processes.
+//   (--scores-worker <worker>,<level>,<start> is used internally by --scores-stress on Windows.)
+// Options can be combined, e.g. --spectate s.sock --slow-render 50 --scripted-input 5000.
+int main(int argc, char* argv[]) {
     // --- Enable ANSI colors on Windows (MUST be called before printing colors) ---
     EnableVirtualTerminalProcessing();
 
@@ -41,6 +61,67 @@ int main() {
     // Pass the total number of level files (e.g., 6 if you have level1.txt to level6.txt).
     Game mazeGame(6); // Update this number if you add/remove level files!
 
+    for (int i = 1; i < argc; ++i) {
+        std::string option = argv[i];
+        if (option == "--solve") {
+            mazeGame.printSolutions();
+            return 0;
+        }
+        if (option == "--scores") {
+            mazeGame.printHighScores();
+            return 0;
+        }
+        if (option == "--bench-fov") {
+            benchmarkFov();
+            return 0;
+        }
+        if (option == "--bench-solver") {
+            benchmarkSolver();
+            return 0;
+        }
+        if (option == "--bench-enemies") {
+            benchmarkEnemies();
+            return 0;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for option: " << option << std::endl;
+            return 1;
+        }
+        std::string value = argv[++i];
+        if (option == "--watch") {
+            return Spectator::watch(value) ? 0 : 1;
+        }
+        else if (option == "--spectate") {
+            if (!mazeGame.enableSpectators(value)) {
+                return 1;
+            }
+        }
+        else if (option == "--slow-render") {
+            mazeGame.setRenderDelay(std::stoi(value));
+        }
+        else if (option == "--scripted-input") {
+            mazeGame.setScriptedInput(std::stoi(value));
+        }
+        else if (option == "--scores-stress") {
+            stressHighScores(std::stoi(value));
+            return 0;
+        }
+        else if (option == "--scores-worker") {
+            int worker = 0;
+            int level = 0;
+            long long startAtMs = 0;
+            if (std::sscanf(value.c_str(), "%d,%d,%lld", &worker, &level, &startAtMs) != 3) {
+                std::cerr << "Invalid value for --scores-worker: " << value << std::endl;
+                return 1;
+            }
+            return runHighScoreWorker(worker, level, startAtMs) ? 0 : 1;
+        }
+        else {
+            std::cerr << "Unknown option: " << option << std::endl;
+            return 1;
+        }
+    }
+
     // Start the game execution by calling the run() method.
     mazeGame.run();
 